@@ -48,6 +48,12 @@ class GreedyAmbiguityResolutionAlgorithm final : public IAlgorithm {
 
     /// Minimum number of measurement to form a track.
     std::size_t nMeasurementsMin = 7;
+
+    /// Resolve the connected components of the shared-measurement graph in
+    /// parallel. The result is identical to the one of the serial solver,
+    /// which is still used if more than one shared hit is allowed or if the
+    /// iteration limit would be reached.
+    bool parallel = false;
   };
 
   /// Construct the ambiguity resolution algorithm.
@@ -66,6 +72,14 @@ class GreedyAmbiguityResolutionAlgorithm final : public IAlgorithm {
   const Config& config() const { return m_cfg; }
 
  private:
+  /// Resolve the connected components of the shared-measurement graph
+  /// independently and in parallel.
+  ///
+  /// @param state is the initial state of the whole event
+  /// @return false if the result could differ from the serial solver, in
+  ///         which case the state is left untouched
+  bool resolveComponents(Acts::GreedyAmbiguityResolution::State& state) const;
+
   Config m_cfg;
   Acts::GreedyAmbiguityResolution m_core;
 
@@ -63,6 +63,11 @@ class ScoreBasedAmbiguityResolutionAlgorithm final : public IAlgorithm {
     double etaMax = 5;
 
     bool useAmbiguityFunction = false;
+
+    /// Solve the connected components of the shared-measurement graph in
+    /// parallel. Tracks which do not share measurements do not influence each
+    /// other, so the result is identical to the one for the whole event.
+    bool parallel = false;
   };
 
   /// Construct the ambiguity resolution algorithm.
@@ -0,0 +1,82 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Group tracks into the connected components of the shared-measurement
+/// graph.
+///
+/// Two tracks are connected if they share at least one measurement. Tracks in
+/// different components cannot influence each other during the ambiguity
+/// resolution, so the components can be resolved independently.
+///
+/// @param measurementsPerTrack the measurements of each track
+/// @param measurementIndex projection from an entry of @p measurementsPerTrack
+///        to its measurement index
+///
+/// @return the components with their track indices in increasing order; the
+///         components are ordered by their first track
+template <typename track_measurements_t, typename projection_t>
+std::vector<std::vector<std::size_t>> connectedTrackComponents(
+    const std::vector<track_measurements_t>& measurementsPerTrack,
+    const projection_t& measurementIndex) {
+  const std::size_t nTracks = measurementsPerTrack.size();
+
+  // Union-find over the tracks where the root is the lowest track index
+  std::vector<std::size_t> parent(nTracks);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto findRoot = [&](std::size_t iTrack) {
+    while (parent[iTrack] != iTrack) {
+      parent[iTrack] = parent[parent[iTrack]];
+      iTrack = parent[iTrack];
+    }
+    return iTrack;
+  };
+
+  std::unordered_map<std::size_t, std::size_t> firstTrackPerMeasurement;
+  for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+    for (const auto& measurement : measurementsPerTrack[iTrack]) {
+      auto [it, inserted] = firstTrackPerMeasurement.try_emplace(
+          measurementIndex(measurement), iTrack);
+      if (inserted) {
+        continue;
+      }
+      std::size_t rootA = findRoot(it->second);
+      std::size_t rootB = findRoot(iTrack);
+      if (rootA != rootB) {
+        parent[std::max(rootA, rootB)] = std::min(rootA, rootB);
+      }
+    }
+  }
+
+  // The root of a track is never larger than the track index, so the
+  // component of the root is always known when the track is visited
+  std::vector<std::vector<std::size_t>> components;
+  std::vector<std::size_t> componentOfRoot(
+      nTracks, std::numeric_limits<std::size_t>::max());
+  for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+    std::size_t root = findRoot(iTrack);
+    if (root == iTrack) {
+      componentOfRoot[iTrack] = components.size();
+      components.emplace_back();
+    }
+    components[componentOfRoot[root]].push_back(iTrack);
+  }
+  return components;
+}
+
+}  // namespace ActsExamples
@@ -11,15 +11,19 @@
 #include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
 #include "Acts/EventData/MultiTrajectoryHelpers.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/AmbiguityResolution/TrackComponents.hpp"
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
 #include <numeric>
 #include <stdexcept>
+#include <vector>
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
@@ -45,6 +49,30 @@ bool sourceLinkEquality(const Acts::SourceLink& a, const Acts::SourceLink& b) {
          b.get<ActsExamples::IndexSourceLink>().index();
 }
 
+/// Extract the initial state of a subset of the tracks.
+///
+/// The tracks are renumbered in the order of @p component, which keeps the
+/// relative order and with it the tie-breaking of the solver.
+Acts::GreedyAmbiguityResolution::State componentState(
+    const Acts::GreedyAmbiguityResolution::State& state,
+    const std::vector<std::size_t>& component) {
+  Acts::GreedyAmbiguityResolution::State result;
+  result.numberOfTracks = component.size();
+  for (std::size_t iLocal = 0; iLocal < component.size(); ++iLocal) {
+    std::size_t iTrack = component[iLocal];
+    result.trackTips.push_back(state.trackTips[iTrack]);
+    result.trackChi2.push_back(state.trackChi2[iTrack]);
+    result.measurementsPerTrack.push_back(state.measurementsPerTrack[iTrack]);
+    result.sharedMeasurementsPerTrack.push_back(
+        state.sharedMeasurementsPerTrack[iTrack]);
+    result.selectedTracks.insert(result.selectedTracks.end(), iLocal);
+    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
+      result.tracksPerMeasurement[iMeasurement].insert(iLocal);
+    }
+  }
+  return result;
+}
+
 }  // namespace
 
 ActsExamples::GreedyAmbiguityResolutionAlgorithm::
@@ -60,6 +88,11 @@ ActsExamples::GreedyAmbiguityResolutionAlgorithm::
   if (m_cfg.outputTracks.empty()) {
     throw std::invalid_argument("Missing trajectories output collection");
   }
+  if (m_cfg.parallel && m_cfg.maximumSharedHits > 1) {
+    ACTS_WARNING(
+        "Parallel resolution is only equivalent to the serial one for at "
+        "most one shared hit, the serial solver will be used");
+  }
   m_inputTracks.initialize(m_cfg.inputTracks);
   m_outputTracks.initialize(m_cfg.outputTracks);
 }
@@ -77,7 +110,9 @@ ActsExamples::GreedyAmbiguityResolutionAlgorithm::execute(
 
   ACTS_VERBOSE("State initialized");
 
-  m_core.resolve(state);
+  if (!m_cfg.parallel || !resolveComponents(state)) {
+    m_core.resolve(state);
+  }
 
   ACTS_INFO("Resolved to " << state.selectedTracks.size() << " tracks from "
                            << tracks.size());
@@ -101,3 +136,59 @@ ActsExamples::GreedyAmbiguityResolutionAlgorithm::execute(
   m_outputTracks(ctx, std::move(outputTracks));
   return ActsExamples::ProcessCode::SUCCESS;
 }
+
+bool ActsExamples::GreedyAmbiguityResolutionAlgorithm::resolveComponents(
+    Acts::GreedyAmbiguityResolution::State& state) const {
+  // With at most one allowed shared hit, every iteration of the serial solver
+  // removes the worst track of a component which still has shared hits, and
+  // a component without shared hits is never touched again. The removals of
+  // the serial solver are therefore an interleaving of the ones of the
+  // individual components.
+  if (m_cfg.maximumSharedHits > 1) {
+    return false;
+  }
+
+  auto components = connectedTrackComponents(
+      state.measurementsPerTrack,
+      [](std::size_t iMeasurement) { return iMeasurement; });
+  ACTS_VERBOSE("Found " << components.size() << " connected components");
+
+  std::vector<std::vector<std::size_t>> selectedTracks(components.size());
+  std::vector<std::size_t> removedTracks(components.size(), 0);
+  tbbWrap::parallel_for(
+      tbb::blocked_range<std::size_t>(0, components.size()),
+      [&](const tbb::blocked_range<std::size_t>& range) {
+        for (std::size_t ic = range.begin(); ic != range.end(); ++ic) {
+          const auto& component = components[ic];
+          // A single track has no shared hits and is kept by the solver
+          if (component.size() == 1 && m_cfg.maximumSharedHits > 0) {
+            selectedTracks[ic] = component;
+            continue;
+          }
+          auto subState = componentState(state, component);
+          m_core.resolve(subState);
+          for (auto iLocal : subState.selectedTracks) {
+            selectedTracks[ic].push_back(component[iLocal]);
+          }
+          removedTracks[ic] = component.size() - selectedTracks[ic].size();
+        }
+      });
+
+  // The serial solver stops after a fixed number of removals in total
+  std::size_t nRemoved = std::accumulate(removedTracks.begin(),
+                                         removedTracks.end(), std::size_t{0});
+  if (nRemoved > m_cfg.maximumIterations) {
+    ACTS_DEBUG("Iteration limit reached, falling back to the serial solver");
+    return false;
+  }
+
+  std::vector<std::size_t> selected;
+  selected.reserve(state.numberOfTracks - nRemoved);
+  for (const auto& tracks : selectedTracks) {
+    selected.insert(selected.end(), tracks.begin(), tracks.end());
+  }
+  std::sort(selected.begin(), selected.end());
+  state.selectedTracks.clear();
+  state.selectedTracks.insert(selected.begin(), selected.end());
+  return true;
+}
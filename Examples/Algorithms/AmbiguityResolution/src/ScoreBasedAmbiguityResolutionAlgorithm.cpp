@@ -12,12 +12,17 @@
 #include "Acts/EventData/MultiTrajectoryHelpers.hpp"
 #include "Acts/Plugins/Json/AmbiguityConfigJsonConverter.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/AmbiguityResolution/TrackComponents.hpp"
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <fstream>
+#include <vector>
 
 namespace {
 
@@ -91,6 +96,75 @@ bool doubleHolesFilter(const Acts::TrackProxy<Acts::ConstVectorTrackContainer,
   }
 }
 
+using MeasurementsPerTrack = std::vector<
+    std::vector<Acts::ScoreBasedAmbiguityResolution::MeasurementInfo>>;
+using TrackFeaturesPerTrack = std::vector<
+    std::vector<Acts::ScoreBasedAmbiguityResolution::TrackFeatures>>;
+
+/// Solve the ambiguities of the connected components of the shared-measurement
+/// graph in parallel.
+///
+/// Each task solves the union of a range of components on a copy of their
+/// tracks. The selected tracks are returned in increasing order, as for the
+/// whole event.
+template <typename optional_cuts_t>
+std::vector<int> solveComponents(
+    const Acts::ScoreBasedAmbiguityResolution& ambi,
+    const ActsExamples::ConstTrackContainer& tracks,
+    const MeasurementsPerTrack& measurementsPerTracks,
+    const TrackFeaturesPerTrack& trackFeaturesVectors,
+    const optional_cuts_t& optionalCuts) {
+  auto components = ActsExamples::connectedTrackComponents(
+      measurementsPerTracks,
+      [](const auto& measurement) { return measurement.iMeasurement; });
+
+  std::vector<char> selected(tracks.size(), 0);
+  ActsExamples::tbbWrap::parallel_for(
+      tbb::blocked_range<std::size_t>(0, components.size()),
+      [&](const tbb::blocked_range<std::size_t>& range) {
+        std::vector<std::size_t> subset;
+        for (std::size_t ic = range.begin(); ic != range.end(); ++ic) {
+          subset.insert(subset.end(), components[ic].begin(),
+                        components[ic].end());
+        }
+        std::sort(subset.begin(), subset.end());
+
+        ActsExamples::TrackContainer subTracks{
+            std::make_shared<Acts::VectorTrackContainer>(),
+            std::make_shared<Acts::VectorMultiTrajectory>()};
+        subTracks.ensureDynamicColumns(tracks);
+        MeasurementsPerTrack subMeasurements;
+        TrackFeaturesPerTrack subFeatures;
+        subMeasurements.reserve(subset.size());
+        subFeatures.reserve(subset.size());
+        for (auto iTrack : subset) {
+          auto destProxy = subTracks.makeTrack();
+          auto srcProxy = tracks.getTrack(iTrack);
+          destProxy.copyFrom(srcProxy, false);
+          destProxy.tipIndex() = srcProxy.tipIndex();
+          subMeasurements.push_back(measurementsPerTracks[iTrack]);
+          subFeatures.push_back(trackFeaturesVectors[iTrack]);
+        }
+
+        ActsExamples::ConstTrackContainer constSubTracks{
+            std::make_shared<Acts::ConstVectorTrackContainer>(
+                std::move(subTracks.container())),
+            tracks.trackStateContainerHolder()};
+        for (auto iLocal : ambi.solveAmbiguity(constSubTracks, subMeasurements,
+                                               subFeatures, optionalCuts)) {
+          selected[subset[iLocal]] = 1;
+        }
+      });
+
+  std::vector<int> goodTracks;
+  for (std::size_t iTrack = 0; iTrack < selected.size(); ++iTrack) {
+    if (selected[iTrack] != 0) {
+      goodTracks.push_back(static_cast<int>(iTrack));
+    }
+  }
+  return goodTracks;
+}
+
 }  // namespace
 
 ActsExamples::ScoreBasedAmbiguityResolutionAlgorithm::
@@ -129,8 +203,15 @@ ActsExamples::ScoreBasedAmbiguityResolutionAlgorithm::execute(
       std::shared_ptr, true>
       optionalCuts;
   optionalCuts.cuts.push_back(doubleHolesFilter);
-  std::vector<int> goodTracks = m_ambi.solveAmbiguity(
-      tracks, measurementsPerTracks, trackFeaturesVectors, optionalCuts);
+  std::vector<int> goodTracks;
+  if (m_cfg.parallel && measurementsPerTracks.size() == tracks.size() &&
+      trackFeaturesVectors.size() == tracks.size()) {
+    goodTracks = solveComponents(m_ambi, tracks, measurementsPerTracks,
+                                 trackFeaturesVectors, optionalCuts);
+  } else {
+    goodTracks = m_ambi.solveAmbiguity(tracks, measurementsPerTracks,
+                                       trackFeaturesVectors, optionalCuts);
+  }
   // Prepare the output track collection from the IDs
   TrackContainer solvedTracks{std::make_shared<Acts::VectorTrackContainer>(),
                               std::make_shared<Acts::VectorMultiTrajectory>()};
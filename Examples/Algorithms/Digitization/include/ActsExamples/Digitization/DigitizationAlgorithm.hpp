@@ -25,12 +25,14 @@
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Utilities/Range.hpp"
 #include "ActsFatras/Digitization/Channelizer.hpp"
 #include "ActsFatras/Digitization/Segmentizer.hpp"
 #include "ActsFatras/Digitization/UncorrelatedHitSmearer.hpp"
 
 #include <cstddef>
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -89,6 +91,27 @@ class DigitizationAlgorithm final : public IAlgorithm {
                                  CombinedDigitizer<2>, CombinedDigitizer<3>,
                                  CombinedDigitizer<4>>;
 
+  /// Digitized parameters of a module with their contributing simulated hits
+  using ModuleDigitization = std::vector<
+      std::pair<DigitizedParameters, std::set<SimHitContainer::size_type>>>;
+
+  /// Digitize the simulated hits of a single module
+  ///
+  /// @param ctx is the algorithm context with event information
+  /// @param simHits are all simulated hits of the event
+  /// @param moduleSimHits are the simulated hits of the module
+  /// @param surface is the surface of the module
+  /// @param digitizer is the digitizer of the module
+  /// @param rng is the random number engine
+  /// @param skippedHits counts the hits for which the smearing failed
+  ///
+  /// @return the digitized parameters of the module
+  ModuleDigitization digitizeModule(
+      const AlgorithmContext& ctx, const SimHitContainer& simHits,
+      const Range<SimHitContainer::const_iterator>& moduleSimHits,
+      const Acts::Surface& surface, const Digitizer& digitizer,
+      RandomEngine& rng, std::size_t& skippedHits) const;
+
   /// Configuration of the Algorithm
   DigitizationConfig m_cfg;
   /// Digitizers within geometry hierarchy
@@ -164,6 +164,11 @@ class DigitizationConfig {
   double minEnergyDeposit = 0.0;  // 1000 * 3.65 * Acts::UnitConstants::eV;
   /// The digitizers per GeometryIdentifiers
   Acts::GeometryHierarchyMap<DigiComponentsConfig> digitizationConfigs;
+  /// Digitize the modules of an event in parallel. Every module uses its own
+  /// random number stream derived from the event and the module geometry id,
+  /// so the output does not depend on the number of threads. It differs from
+  /// the output of the serial mode, which uses one stream for all modules.
+  bool parallel = false;
 
   std::vector<
       std::pair<Acts::GeometryIdentifier, std::vector<Acts::BoundIndices>>>
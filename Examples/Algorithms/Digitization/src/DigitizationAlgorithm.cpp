@@ -23,6 +23,7 @@
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Utilities/GroupBy.hpp"
 #include "ActsExamples/Utilities/Range.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 #include "ActsFatras/EventData/Hit.hpp"
 
@@ -148,21 +149,16 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
   measurementParticlesMap.reserve(simHits.size());
   measurementSimHitsMap.reserve(simHits.size());
 
-  // Setup random number generator
-  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-
-  // Some statistics
-  std::size_t skippedHits = 0;
-
-  ACTS_DEBUG("Starting loop over modules ...");
-  for (const auto& simHitsGroup : groupByModule(simHits)) {
-    // Manual pair unpacking instead of using
-    //   auto [moduleGeoId, moduleSimHits] : ...
-    // otherwise clang on macos complains that it is unable to capture the local
-    // binding in the lambda used for visiting the smearer below.
-    Acts::GeometryIdentifier moduleGeoId = simHitsGroup.first;
-    const auto& moduleSimHits = simHitsGroup.second;
+  // Collect the modules which have a digitizer
+  struct Module {
+    Acts::GeometryIdentifier geoId;
+    Range<SimHitContainer::const_iterator> simHits;
+    const Acts::Surface* surface = nullptr;
+    const Digitizer* digitizer = nullptr;
+  };
+  std::vector<Module> modules;
 
+  for (const auto& [moduleGeoId, moduleSimHits] : groupByModule(simHits)) {
     auto surfaceItr = m_cfg.surfaceByIdentifier.find(moduleGeoId);
 
     if (surfaceItr == m_cfg.surfaceByIdentifier.end()) {
@@ -173,8 +169,6 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
       return ProcessCode::ABORT;
     }
 
-    const Acts::Surface* surfacePtr = surfaceItr->second;
-
     auto digitizerItr = m_digitizers.find(moduleGeoId);
     if (digitizerItr == m_digitizers.end()) {
       ACTS_VERBOSE("No digitizer present for module " << moduleGeoId);
@@ -183,106 +177,73 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
       ACTS_VERBOSE("Digitizer found for module " << moduleGeoId);
     }
 
-    // Run the digitizer. Iterate over the hits for this surface inside the
-    // visitor so we do not need to lookup the variant object per-hit.
-    std::visit(
-        [&](const auto& digitizer) {
-          ModuleClusters moduleClusters(
-              digitizer.geometric.segmentation, digitizer.geometric.indices,
-              m_cfg.doMerge, m_cfg.mergeNsigma, m_cfg.mergeCommonCorner);
-
-          for (auto h = moduleSimHits.begin(); h != moduleSimHits.end(); ++h) {
-            const auto& simHit = *h;
-            const auto simHitIdx = simHits.index_of(h);
-
-            DigitizedParameters dParameters;
-
-            if (simHit.depositedEnergy() < m_cfg.minEnergyDeposit) {
-              ACTS_VERBOSE("Skip hit because energy deposit to small");
-              continue;
-            }
-
-            // Geometric part - 0, 1, 2 local parameters are possible
-            if (!digitizer.geometric.indices.empty()) {
-              ACTS_VERBOSE("Configured to geometric digitize "
-                           << digitizer.geometric.indices.size()
-                           << " parameters.");
-              const auto& cfg = digitizer.geometric;
-              Acts::Vector3 driftDir = cfg.drift(simHit.position(), rng);
-              auto channelsRes = m_channelizer.channelize(
-                  simHit, *surfacePtr, ctx.geoContext, driftDir,
-                  cfg.segmentation, cfg.thickness);
-              if (!channelsRes.ok() || channelsRes->empty()) {
-                ACTS_DEBUG(
-                    "Geometric channelization did not work, skipping this "
-                    "hit.");
-                continue;
-              }
-              ACTS_VERBOSE("Activated " << channelsRes->size()
-                                        << " channels for this hit.");
-              dParameters =
-                  localParameters(digitizer.geometric, *channelsRes, rng);
-            }
+    modules.push_back(
+        {moduleGeoId, moduleSimHits, surfaceItr->second, &(*digitizerItr)});
+  }
 
-            // Smearing part - (optionally) rest
-            if (!digitizer.smearing.indices.empty()) {
-              ACTS_VERBOSE("Configured to smear "
-                           << digitizer.smearing.indices.size()
-                           << " parameters.");
-              auto res =
-                  digitizer.smearing(rng, simHit, *surfacePtr, ctx.geoContext);
-              if (!res.ok()) {
-                ++skippedHits;
-                ACTS_DEBUG("Problem in hit smearing, skip hit ("
-                           << res.error().message() << ")");
-                continue;
-              }
-              const auto& [par, cov] = res.value();
-              for (Eigen::Index ip = 0; ip < par.rows(); ++ip) {
-                dParameters.indices.push_back(digitizer.smearing.indices[ip]);
-                dParameters.values.push_back(par[ip]);
-                dParameters.variances.push_back(cov(ip, ip));
-              }
-            }
+  // Some statistics
+  std::size_t skippedHits = 0;
 
-            // Check on success - threshold could have eliminated all channels
-            if (dParameters.values.empty()) {
-              ACTS_VERBOSE(
-                  "Parameter digitization did not yield a measurement.");
-              continue;
-            }
+  std::vector<ModuleDigitization> digitizedModules(modules.size());
 
-            moduleClusters.add(std::move(dParameters), simHitIdx);
+  ACTS_DEBUG("Starting loop over modules ...");
+  if (m_cfg.parallel) {
+    std::vector<std::size_t> skippedModuleHits(modules.size(), 0);
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, modules.size()),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          for (std::size_t im = range.begin(); im != range.end(); ++im) {
+            const auto& module = modules[im];
+            auto rng =
+                m_cfg.randomNumbers->spawnGenerator(ctx, module.geoId.value());
+            digitizedModules[im] = digitizeModule(
+                ctx, simHits, module.simHits, *module.surface,
+                *module.digitizer, rng, skippedModuleHits[im]);
           }
+        });
+    for (auto skipped : skippedModuleHits) {
+      skippedHits += skipped;
+    }
+  } else {
+    // Setup random number generator
+    auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
+
+    for (std::size_t im = 0; im < modules.size(); ++im) {
+      const auto& module = modules[im];
+      digitizedModules[im] =
+          digitizeModule(ctx, simHits, module.simHits, *module.surface,
+                         *module.digitizer, rng, skippedHits);
+    }
+  }
 
-          for (auto& [dParameters, simhits] :
-               moduleClusters.digitizedParameters()) {
-            // The measurement container is unordered and the index under which
-            // the measurement will be stored is known before adding it.
-            Index measurementIdx = measurements.size();
-            IndexSourceLink sourceLink{moduleGeoId, measurementIdx};
-
-            // Add to output containers:
-            // index map and source link container are geometry-ordered.
-            // since the input is also geometry-ordered, new items can
-            // be added at the end.
-            sourceLinks.insert(sourceLinks.end(), sourceLink);
-
-            measurements.emplace_back(
-                createMeasurement(dParameters, sourceLink));
-            clusters.emplace_back(std::move(dParameters.cluster));
-            // this digitization does hit merging so there can be more than one
-            // mapping entry for each digitized hit.
-            for (auto simHitIdx : simhits) {
-              measurementParticlesMap.emplace_hint(
-                  measurementParticlesMap.end(), measurementIdx,
-                  simHits.nth(simHitIdx)->particleId());
-              measurementSimHitsMap.emplace_hint(measurementSimHitsMap.end(),
-                                                 measurementIdx, simHitIdx);
-            }
-          }
-        },
-        *digitizerItr);
+  // Fill the output containers in module order
+  for (std::size_t im = 0; im < modules.size(); ++im) {
+    const Acts::GeometryIdentifier moduleGeoId = modules[im].geoId;
+
+    for (auto& [dParameters, simhits] : digitizedModules[im]) {
+      // The measurement container is unordered and the index under which
+      // the measurement will be stored is known before adding it.
+      Index measurementIdx = measurements.size();
+      IndexSourceLink sourceLink{moduleGeoId, measurementIdx};
+
+      // Add to output containers:
+      // index map and source link container are geometry-ordered.
+      // since the input is also geometry-ordered, new items can
+      // be added at the end.
+      sourceLinks.insert(sourceLinks.end(), sourceLink);
+
+      measurements.emplace_back(createMeasurement(dParameters, sourceLink));
+      clusters.emplace_back(std::move(dParameters.cluster));
+      // this digitization does hit merging so there can be more than one
+      // mapping entry for each digitized hit.
+      for (auto simHitIdx : simhits) {
+        measurementParticlesMap.emplace_hint(
+            measurementParticlesMap.end(), measurementIdx,
+            simHits.nth(simHitIdx)->particleId());
+        measurementSimHitsMap.emplace_hint(measurementSimHitsMap.end(),
+                                           measurementIdx, simHitIdx);
+      }
+    }
   }
 
   if (skippedHits > 0) {
@@ -299,6 +260,90 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
   return ProcessCode::SUCCESS;
 }
 
+ActsExamples::DigitizationAlgorithm::ModuleDigitization
+ActsExamples::DigitizationAlgorithm::digitizeModule(
+    const AlgorithmContext& ctx, const SimHitContainer& simHits,
+    const Range<SimHitContainer::const_iterator>& moduleSimHits,
+    const Acts::Surface& surface, const Digitizer& digitizer,
+    RandomEngine& rng, std::size_t& skippedHits) const {
+  // Run the digitizer. Iterate over the hits for this surface inside the
+  // visitor so we do not need to lookup the variant object per-hit.
+  return std::visit(
+      [&](const auto& moduleDigitizer) {
+        ModuleClusters moduleClusters(
+            moduleDigitizer.geometric.segmentation,
+            moduleDigitizer.geometric.indices, m_cfg.doMerge,
+            m_cfg.mergeNsigma, m_cfg.mergeCommonCorner);
+
+        for (auto h = moduleSimHits.begin(); h != moduleSimHits.end(); ++h) {
+          const auto& simHit = *h;
+          const auto simHitIdx = simHits.index_of(h);
+
+          DigitizedParameters dParameters;
+
+          if (simHit.depositedEnergy() < m_cfg.minEnergyDeposit) {
+            ACTS_VERBOSE("Skip hit because energy deposit to small");
+            continue;
+          }
+
+          // Geometric part - 0, 1, 2 local parameters are possible
+          if (!moduleDigitizer.geometric.indices.empty()) {
+            ACTS_VERBOSE("Configured to geometric digitize "
+                         << moduleDigitizer.geometric.indices.size()
+                         << " parameters.");
+            const auto& cfg = moduleDigitizer.geometric;
+            Acts::Vector3 driftDir = cfg.drift(simHit.position(), rng);
+            auto channelsRes = m_channelizer.channelize(
+                simHit, surface, ctx.geoContext, driftDir, cfg.segmentation,
+                cfg.thickness);
+            if (!channelsRes.ok() || channelsRes->empty()) {
+              ACTS_DEBUG(
+                  "Geometric channelization did not work, skipping this "
+                  "hit.");
+              continue;
+            }
+            ACTS_VERBOSE("Activated " << channelsRes->size()
+                                      << " channels for this hit.");
+            dParameters =
+                localParameters(moduleDigitizer.geometric, *channelsRes, rng);
+          }
+
+          // Smearing part - (optionally) rest
+          if (!moduleDigitizer.smearing.indices.empty()) {
+            ACTS_VERBOSE("Configured to smear "
+                         << moduleDigitizer.smearing.indices.size()
+                         << " parameters.");
+            auto res =
+                moduleDigitizer.smearing(rng, simHit, surface, ctx.geoContext);
+            if (!res.ok()) {
+              ++skippedHits;
+              ACTS_DEBUG("Problem in hit smearing, skip hit ("
+                         << res.error().message() << ")");
+              continue;
+            }
+            const auto& [par, cov] = res.value();
+            for (Eigen::Index ip = 0; ip < par.rows(); ++ip) {
+              dParameters.indices.push_back(
+                  moduleDigitizer.smearing.indices[ip]);
+              dParameters.values.push_back(par[ip]);
+              dParameters.variances.push_back(cov(ip, ip));
+            }
+          }
+
+          // Check on success - threshold could have eliminated all channels
+          if (dParameters.values.empty()) {
+            ACTS_VERBOSE("Parameter digitization did not yield a measurement.");
+            continue;
+          }
+
+          moduleClusters.add(std::move(dParameters), simHitIdx);
+        }
+
+        return moduleClusters.digitizedParameters();
+      },
+      digitizer);
+}
+
 ActsExamples::DigitizedParameters
 ActsExamples::DigitizationAlgorithm::localParameters(
     const GeometricConfig& geoCfg,
@@ -89,6 +89,14 @@ class FatrasSimulation final : public IAlgorithm {
     /// algorithm function. It is used to guess the amount of memory to
     /// pre-allocate to avoid allocation during event simulation.
     std::size_t averageHitsPerParticle = 16u;
+
+    /// Simulate the input particles of an event in parallel.
+    ///
+    /// Each input particle is simulated together with its secondaries using
+    /// a random number stream derived from the event and its barcode, so the
+    /// output does not depend on the number of threads. It differs from the
+    /// output of the serial mode, which uses one stream for all particles.
+    bool parallel = false;
   };
 
   /// Construct the algorithm from a config.
@@ -24,6 +24,7 @@
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 #include "ActsFatras/EventData/Particle.hpp"
 #include "ActsFatras/Kernel/InteractionList.hpp"
@@ -237,21 +238,83 @@ ActsExamples::ProcessCode ActsExamples::FatrasSimulation::execute(
   simHitsUnordered.reserve(inputParticles.size() *
                            m_cfg.averageHitsPerParticle);
 
-  // run the simulation w/ a local random generator
-  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-  auto ret = m_sim->simulate(ctx.geoContext, ctx.magFieldContext, rng,
-                             inputParticles, particlesInitialUnordered,
-                             particlesFinalUnordered, simHitsUnordered);
-  // fatal error leads to panic
-  if (!ret.ok()) {
-    ACTS_FATAL("event " << ctx.eventNumber << " simulation failed with error "
-                        << ret.error());
-    return ProcessCode::ABORT;
+  std::vector<ActsFatras::FailedParticle> failedParticles;
+
+  if (!m_cfg.parallel) {
+    // run the simulation w/ a local random generator
+    auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
+    auto ret = m_sim->simulate(ctx.geoContext, ctx.magFieldContext, rng,
+                               inputParticles, particlesInitialUnordered,
+                               particlesFinalUnordered, simHitsUnordered);
+    // fatal error leads to panic
+    if (!ret.ok()) {
+      ACTS_FATAL("event " << ctx.eventNumber
+                          << " simulation failed with error " << ret.error());
+      return ProcessCode::ABORT;
+    }
+    failedParticles = std::move(ret.value());
+  } else {
+    // every input particle is simulated together with its secondaries using
+    // a random generator and output buffers of its own
+    struct ParticleOutput {
+      SimParticleContainer::sequence_type particlesInitial;
+      SimParticleContainer::sequence_type particlesFinal;
+      SimHitContainer::sequence_type simHits;
+      std::vector<ActsFatras::FailedParticle> failed;
+      std::error_code error;
+    };
+    std::vector<ParticleOutput> outputs(inputParticles.size());
+
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, inputParticles.size()),
+        [&](const tbb::blocked_range<std::size_t> &range) {
+          for (std::size_t ip = range.begin(); ip != range.end(); ++ip) {
+            const auto &particle = *inputParticles.nth(ip);
+            auto &output = outputs[ip];
+
+            SimParticleContainer particles;
+            particles.insert(particle);
+
+            auto rng = m_cfg.randomNumbers->spawnGenerator(
+                ctx, particle.particleId().value());
+            auto ret = m_sim->simulate(
+                ctx.geoContext, ctx.magFieldContext, rng, particles,
+                output.particlesInitial, output.particlesFinal,
+                output.simHits);
+            if (!ret.ok()) {
+              output.error = ret.error();
+            } else {
+              output.failed = std::move(ret.value());
+            }
+          }
+        });
+
+    // merge in the order of the input particles
+    for (auto &output : outputs) {
+      // fatal error leads to panic
+      if (output.error) {
+        ACTS_FATAL("event " << ctx.eventNumber
+                            << " simulation failed with error "
+                            << output.error);
+        return ProcessCode::ABORT;
+      }
+      particlesInitialUnordered.insert(particlesInitialUnordered.end(),
+                                       output.particlesInitial.begin(),
+                                       output.particlesInitial.end());
+      particlesFinalUnordered.insert(particlesFinalUnordered.end(),
+                                     output.particlesFinal.begin(),
+                                     output.particlesFinal.end());
+      simHitsUnordered.insert(simHitsUnordered.end(), output.simHits.begin(),
+                              output.simHits.end());
+      failedParticles.insert(failedParticles.end(), output.failed.begin(),
+                             output.failed.end());
+    }
   }
+
   // failed particles are just logged. assumes that failed particles are due
   // to edge-cases representing a tiny fraction of the event; not due to a
   // fundamental issue.
-  for (const auto &failed : ret.value()) {
+  for (const auto &failed : failedParticles) {
     ACTS_ERROR("event " << ctx.eventNumber << " particle " << failed.particle
                         << " failed to simulate with error " << failed.error
                         << ": " << failed.error.message());
@@ -18,10 +18,11 @@
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 #include "ActsExamples/Geant4/SensitiveSurfaceMapper.hpp"
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 class G4RunManager;
 class G4VUserPrimaryGeneratorAction;
@@ -89,6 +90,11 @@ class Geant4SimulationBase : public IAlgorithm {
  protected:
   void commonInitialization();
 
+  /// Simulate one event, the caller has to hold the Geant4 instance mutex
+  ///
+  /// @param ctx the AlgorithmContext for this event
+  ProcessCode simulateEvent(const AlgorithmContext& ctx) const;
+
   G4RunManager& runManager() const;
 
   EventStore& eventStore() const;
@@ -204,14 +210,22 @@ class Geant4MaterialRecording final : public Geant4SimulationBase {
   ActsExamples::ProcessCode execute(
       const ActsExamples::AlgorithmContext& ctx) const final;
 
+  /// Report the recording throughput
+  ActsExamples::ProcessCode finalize() final;
+
   /// Readonly access to the configuration
   const Config& config() const final { return m_cfg; }
 
  private:
   Config m_cfg;
 
-  WriteDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
+  WriteDataHandle<std::vector<Acts::RecordedMaterialTrack>>
       m_outputMaterialTracks{this, "OutputMaterialTracks"};
+
+  /// Number of recorded material steps and the Geant4 processing time,
+  /// excluding the time spent waiting for the Geant4 instance
+  mutable std::atomic<std::size_t> m_nMaterialSteps{0};
+  mutable std::atomic<std::size_t> m_simulationTimeNs{0};
 };
 
 }  // namespace ActsExamples
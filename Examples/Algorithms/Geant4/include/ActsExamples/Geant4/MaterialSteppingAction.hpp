@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "Acts/Material/Material.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/Geant4/EventStore.hpp"
 
@@ -17,6 +18,7 @@
 
 #include <G4UserSteppingAction.hh>
 
+class G4Material;
 class G4Step;
 
 namespace ActsExamples {
@@ -64,6 +66,22 @@ class MaterialSteppingAction final : public G4UserSteppingAction {
 
   /// The looging instance
   std::unique_ptr<const Acts::Logger> m_logger;
+
+  /// Converted material and exclusion flag of a Geant4 material
+  struct CachedMaterial {
+    bool cached = false;
+    bool excluded = false;
+    Acts::Material material;
+  };
+
+  /// Get the cached entry of a Geant4 material, converting it on first use
+  const CachedMaterial& cachedMaterial(const G4Material& material);
+
+  /// Cache indexed by the position of the material in the Geant4 material
+  /// table. A single stepping action is registered with the run manager, and
+  /// it is only called while `Geant4SimulationBase` holds the mutex of the
+  /// Geant4 instance, which also protects the cache.
+  std::vector<CachedMaterial> m_materialCache;
 };
 
 }  // namespace ActsExamples
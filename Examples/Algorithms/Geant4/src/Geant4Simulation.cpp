@@ -31,11 +31,14 @@
 #include "ActsFatras/EventData/Barcode.hpp"
 
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include <G4FieldManager.hh>
 #include <G4RunManager.hh>
@@ -113,6 +116,11 @@ ActsExamples::ProcessCode ActsExamples::Geant4SimulationBase::execute(
   // Ensure exclusive access to the Geant4 run manager
   std::lock_guard<std::mutex> guard(m_geant4Instance->mutex);
 
+  return simulateEvent(ctx);
+}
+
+ActsExamples::ProcessCode ActsExamples::Geant4SimulationBase::simulateEvent(
+    const ActsExamples::AlgorithmContext& ctx) const {
   // Set the seed new per event, so that we get reproducible results
   G4Random::setTheSeed(config().randomNumbers->generateSeed(ctx));
 
@@ -401,11 +409,44 @@ ActsExamples::Geant4MaterialRecording::~Geant4MaterialRecording() = default;
 
 ActsExamples::ProcessCode ActsExamples::Geant4MaterialRecording::execute(
     const ActsExamples::AlgorithmContext& ctx) const {
-  Geant4SimulationBase::execute(ctx);
+  // Ensure exclusive access to the Geant4 run manager. Only the time holding
+  // the lock is counted, so waiting for other threads does not lower the
+  // reported throughput.
+  std::lock_guard<std::mutex> guard(m_geant4Instance->mutex);
+
+  auto start = std::chrono::steady_clock::now();
+  simulateEvent(ctx);
+  auto stop = std::chrono::steady_clock::now();
 
-  // Output handling: Material tracks
-  m_outputMaterialTracks(
-      ctx, decltype(eventStore().materialTracks)(eventStore().materialTracks));
+  std::size_t nSteps = 0;
+  for (const auto& [trackId, rmTrack] : eventStore().materialTracks) {
+    nSteps += rmTrack.second.materialInteractions.size();
+  }
+  m_nMaterialSteps += nSteps;
+  m_simulationTimeNs +=
+      std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+          .count();
+
+  // Output handling: Material tracks, ordered by the Geant4 track id
+  std::map<std::size_t, const Acts::RecordedMaterialTrack*> orderedTracks;
+  for (const auto& [trackId, rmTrack] : eventStore().materialTracks) {
+    orderedTracks.emplace(trackId, &rmTrack);
+  }
+  std::vector<Acts::RecordedMaterialTrack> materialTracks;
+  materialTracks.reserve(orderedTracks.size());
+  for (const auto& [trackId, rmTrack] : orderedTracks) {
+    materialTracks.push_back(*rmTrack);
+  }
+  m_outputMaterialTracks(ctx, std::move(materialTracks));
+
+  return ActsExamples::ProcessCode::SUCCESS;
+}
 
+ActsExamples::ProcessCode ActsExamples::Geant4MaterialRecording::finalize() {
+  const std::size_t nSteps = m_nMaterialSteps;
+  const double seconds = m_simulationTimeNs * 1e-9;
+  ACTS_INFO("Recorded " << nSteps << " material steps in " << seconds << " s ("
+                        << (seconds > 0. ? nSteps / seconds : 0.)
+                        << " steps/s)");
   return ActsExamples::ProcessCode::SUCCESS;
 }
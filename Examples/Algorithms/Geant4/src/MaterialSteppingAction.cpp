@@ -15,6 +15,7 @@
 #include "Acts/Material/MaterialSlab.hpp"
 #include "ActsExamples/Geant4/EventStore.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <ostream>
 #include <unordered_map>
@@ -30,21 +31,26 @@ ActsExamples::MaterialSteppingAction::MaterialSteppingAction(
 
 ActsExamples::MaterialSteppingAction::~MaterialSteppingAction() = default;
 
-void ActsExamples::MaterialSteppingAction::UserSteppingAction(
-    const G4Step* step) {
-  // Get the material & check if it is present
-  G4Material* material = step->GetPreStepPoint()->GetMaterial();
-  if (material == nullptr) {
-    return;
+const ActsExamples::MaterialSteppingAction::CachedMaterial&
+ActsExamples::MaterialSteppingAction::cachedMaterial(
+    const G4Material& material) {
+  const std::size_t index = material.GetIndex();
+  if (index >= m_materialCache.size()) {
+    m_materialCache.resize(index + 1);
   }
+  CachedMaterial& cached = m_materialCache[index];
+  if (cached.cached) {
+    return cached;
+  }
+  cached.cached = true;
 
   // First check for exclusion
-  std::string materialName = material->GetName();
-  for (const auto& emat : m_cfg.excludeMaterials) {
-    if (emat == materialName) {
-      ACTS_VERBOSE("Exclude step in material '" << materialName << "'.");
-      return;
-    }
+  const std::string& materialName = material.GetName();
+  cached.excluded =
+      std::find(m_cfg.excludeMaterials.begin(), m_cfg.excludeMaterials.end(),
+                materialName) != m_cfg.excludeMaterials.end();
+  if (cached.excluded) {
+    return cached;
   }
 
   constexpr double convertLength = Acts::UnitConstants::mm / CLHEP::mm;
@@ -52,24 +58,21 @@ void ActsExamples::MaterialSteppingAction::UserSteppingAction(
       (Acts::UnitConstants::g / Acts::UnitConstants::mm3) /
       (CLHEP::gram / CLHEP::mm3);
 
-  ACTS_VERBOSE("Performing a step with step size = "
-               << convertLength * step->GetStepLength());
-
   // Quantities valid for elemental materials and mixtures
-  double X0 = convertLength * material->GetRadlen();
-  double L0 = convertLength * material->GetNuclearInterLength();
-  double rho = convertDensity * material->GetDensity();
+  double X0 = convertLength * material.GetRadlen();
+  double L0 = convertLength * material.GetNuclearInterLength();
+  double rho = convertDensity * material.GetDensity();
 
   // Get{A,Z} is only meaningful for single-element materials (according to
   // the Geant4 docs). Need to compute average manually.
-  const G4ElementVector* elements = material->GetElementVector();
-  const G4double* fraction = material->GetFractionVector();
-  std::size_t nElements = material->GetNumberOfElements();
+  const G4ElementVector* elements = material.GetElementVector();
+  const G4double* fraction = material.GetFractionVector();
+  std::size_t nElements = material.GetNumberOfElements();
   double Ar = 0.;
   double Z = 0.;
   if (nElements == 1) {
-    Ar = material->GetA() / (CLHEP::gram / CLHEP::mole);
-    Z = material->GetZ();
+    Ar = material.GetA() / (CLHEP::gram / CLHEP::mole);
+    Z = material.GetZ();
   } else {
     for (std::size_t i = 0; i < nElements; i++) {
       Ar += elements->at(i)->GetA() * fraction[i] / (CLHEP::gram / CLHEP::mole);
@@ -77,10 +80,34 @@ void ActsExamples::MaterialSteppingAction::UserSteppingAction(
     }
   }
 
+  cached.material = Acts::Material::fromMassDensity(X0, L0, Ar, Z, rho);
+  ACTS_VERBOSE("Cached material '" << materialName << "'");
+  return cached;
+}
+
+void ActsExamples::MaterialSteppingAction::UserSteppingAction(
+    const G4Step* step) {
+  // Get the material & check if it is present
+  G4Material* material = step->GetPreStepPoint()->GetMaterial();
+  if (material == nullptr) {
+    return;
+  }
+
+  // First check for exclusion
+  const CachedMaterial& cached = cachedMaterial(*material);
+  if (cached.excluded) {
+    ACTS_VERBOSE("Exclude step in material '" << material->GetName() << "'.");
+    return;
+  }
+
+  constexpr double convertLength = Acts::UnitConstants::mm / CLHEP::mm;
+
+  ACTS_VERBOSE("Performing a step with step size = "
+               << convertLength * step->GetStepLength());
+
   // Construct passed material slab for the step
-  const auto slab =
-      Acts::MaterialSlab(Acts::Material::fromMassDensity(X0, L0, Ar, Z, rho),
-                         convertLength * step->GetStepLength());
+  const auto slab = Acts::MaterialSlab(cached.material,
+                                       convertLength * step->GetStepLength());
 
   // Create the RecordedMaterialSlab
   const auto& rawPos = step->GetPreStepPoint()->GetPosition();
@@ -97,17 +124,13 @@ void ActsExamples::MaterialSteppingAction::UserSteppingAction(
   G4Track* g4Track = step->GetTrack();
   std::size_t trackID = g4Track->GetTrackID();
   auto& materialTracks = eventStore().materialTracks;
-  if (materialTracks.find(trackID - 1) == materialTracks.end()) {
-    Acts::RecordedMaterialTrack rmTrack;
+  auto [rmTrack, inserted] = materialTracks.try_emplace(trackID - 1);
+  if (inserted) {
     const auto& g4Vertex = g4Track->GetVertexPosition();
     Acts::Vector3 vertex(g4Vertex[0], g4Vertex[1], g4Vertex[2]);
     const auto& g4Direction = g4Track->GetMomentumDirection();
     Acts::Vector3 direction(g4Direction[0], g4Direction[1], g4Direction[2]);
-    rmTrack.first = {vertex, direction};
-    rmTrack.second.materialInteractions.push_back(mInteraction);
-    materialTracks[trackID - 1] = rmTrack;
-  } else {
-    materialTracks[trackID - 1].second.materialInteractions.push_back(
-        mInteraction);
+    rmTrack->second.first = {vertex, direction};
   }
+  rmTrack->second.second.materialInteractions.push_back(mInteraction);
 }
@@ -11,6 +11,13 @@
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Geometry/VolumeLookupGrid.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace Acts::Experimental {
 class Detector;
@@ -22,6 +29,9 @@ struct AlgorithmContext;
 
 /// This is a test algorithm that checks the unique volume identification
 /// and association for Detector objects
+///
+/// It also measures the volume lookup throughput, which is reported per
+/// event and, summed over all events and threads, at the end of the run.
 class VolumeAssociationTest final : public IAlgorithm {
  public:
   /// Nested Configuration struct
@@ -36,6 +46,9 @@ class VolumeAssociationTest final : public IAlgorithm {
     std::vector<Acts::ActsScalar> randomRange = {};
     /// The detector
     std::shared_ptr<const Acts::Experimental::Detector> detector = nullptr;
+    /// Optional lookup grid, used for the volume search instead of the
+    /// detector and cross-checked against it
+    std::shared_ptr<const VolumeLookupGrid> lookupGrid = nullptr;
   };
 
   /// Construct the  volume association test algorithm
@@ -51,12 +64,20 @@ class VolumeAssociationTest final : public IAlgorithm {
   /// @return a process code indication success or failure
   ProcessCode execute(const AlgorithmContext& ctx) const override;
 
+  /// Report the overall lookup throughput
+  ProcessCode finalize() override;
+
   /// Const access to the config
   const Config& config() const { return m_cfg; }
 
  private:
   /// The algorithm configuration.
   Config m_cfg;
+
+  /// Total number of volume lookups
+  mutable std::atomic<std::size_t> m_nLookups = 0;
+  /// Total time spent in the volume lookups, summed over all threads
+  mutable std::atomic<std::size_t> m_lookupTimeNs = 0;
 };
 
 }  // namespace ActsExamples
@@ -0,0 +1,87 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace Acts::Experimental {
+class Detector;
+class DetectorVolume;
+}  // namespace Acts::Experimental
+
+namespace ActsExamples {
+
+/// Cylindrical lookup grid for the volumes of a Detector object.
+///
+/// Each cell of a regular grid in (r, phi, z) stores the volumes found at a
+/// set of sample points within the cell. A lookup tests these candidates
+/// first and falls back to the search of the detector if none of them
+/// contains the position. The result is a volume containing the position, as
+/// for `Detector::findDetectorVolume`; on a boundary shared by several volumes
+/// it may be a different one of them than the detector search returns.
+class VolumeLookupGrid {
+ public:
+  /// Nested Configuration struct
+  struct Config {
+    /// Number of bins in r
+    std::size_t binsR = 20;
+    /// Number of bins in phi
+    std::size_t binsPhi = 36;
+    /// Number of bins in z
+    std::size_t binsZ = 40;
+    /// Maximal radius covered by the grid
+    Acts::ActsScalar rMax = 1200.;
+    /// Maximal |z| covered by the grid
+    Acts::ActsScalar zMax = 3200.;
+    /// Number of sample points per cell in each dimension
+    std::size_t samplesPerBin = 3;
+  };
+
+  /// Build the lookup grid for a detector
+  ///
+  /// @param cfg is the grid configuration
+  /// @param detector is the detector to be looked up
+  /// @param gctx is the geometry context used to build the grid
+  VolumeLookupGrid(
+      const Config& cfg,
+      std::shared_ptr<const Acts::Experimental::Detector> detector,
+      const Acts::GeometryContext& gctx = Acts::GeometryContext());
+
+  /// Find the detector volume at a global position
+  ///
+  /// @param gctx is the geometry context
+  /// @param position is the global position
+  ///
+  /// @return the volume or nullptr if the position is not in the detector
+  const Acts::Experimental::DetectorVolume* findDetectorVolume(
+      const Acts::GeometryContext& gctx, const Acts::Vector3& position) const;
+
+  /// Const access to the config
+  const Config& config() const { return m_cfg; }
+
+ private:
+  /// Index of the cell containing the position, if it is covered by the grid
+  std::optional<std::size_t> cellIndex(const Acts::Vector3& position) const;
+
+  Config m_cfg;
+  std::shared_ptr<const Acts::Experimental::Detector> m_detector;
+
+  /// Candidate volumes of all cells, the candidates of cell i are stored in
+  /// [m_offsets[i], m_offsets[i + 1])
+  std::vector<std::size_t> m_offsets;
+  std::vector<const Acts::Experimental::DetectorVolume*> m_candidates;
+};
+
+}  // namespace ActsExamples
@@ -11,7 +11,9 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Detector/Detector.hpp"
 #include "Acts/Detector/DetectorVolume.hpp"
+#include "Acts/Utilities/Zip.hpp"
 
+#include <chrono>
 #include <exception>
 #include <memory>
 #include <string>
@@ -51,17 +53,43 @@ ActsExamples::ProcessCode ActsExamples::VolumeAssociationTest::execute(
     return Acts::Vector3(r * cos(phi), r * sin(phi), z);
   };
 
+  std::vector<Acts::Vector3> positions;
+  positions.reserve(m_cfg.ntests);
+  for (std::size_t it = 0; it < m_cfg.ntests; ++it) {
+    positions.push_back(testPosition());
+  }
+
+  auto findVolume = [&](const Acts::Vector3& pos) {
+    return m_cfg.lookupGrid != nullptr
+               ? m_cfg.lookupGrid->findDetectorVolume(ctx.geoContext, pos)
+               : m_cfg.detector->findDetectorVolume(ctx.geoContext, pos);
+  };
+
+  // Only the lookups are timed, the validation is done afterwards
+  std::vector<const Acts::Experimental::DetectorVolume*> volumes;
+  volumes.reserve(positions.size());
+  auto start = std::chrono::steady_clock::now();
+  for (const auto& pos : positions) {
+    volumes.push_back(findVolume(pos));
+  }
+  auto stop = std::chrono::steady_clock::now();
+
   std::size_t failedSearch = 0;
   std::size_t failedAssignment = 0;
-  for (std::size_t it = 0; it < m_cfg.ntests; ++it) {
-    auto pos = testPosition();
-    auto dv = m_cfg.detector->findDetectorVolume(ctx.geoContext, pos);
+  std::size_t failedGridSearch = 0;
+  for (const auto& [pos, dv] : Acts::zip(positions, volumes)) {
     if (dv == nullptr) {
       ++failedSearch;
-    }
-    if (!dv->inside(ctx.geoContext, pos)) {
+    } else if (!dv->inside(ctx.geoContext, pos)) {
       ++failedAssignment;
     }
+    // On boundaries shared by several volumes the grid may return another
+    // volume containing the position than the detector, which is checked
+    // above. It must not miss a volume the detector finds.
+    if (m_cfg.lookupGrid != nullptr && dv == nullptr &&
+        m_cfg.detector->findDetectorVolume(ctx.geoContext, pos) != nullptr) {
+      ++failedGridSearch;
+    }
   }
   if (failedSearch > 0) {
     ACTS_ERROR("Failed to find detector volume " << failedSearch << " times");
@@ -70,6 +98,29 @@ ActsExamples::ProcessCode ActsExamples::VolumeAssociationTest::execute(
     ACTS_ERROR("Failed to assign detector volume " << failedAssignment
                                                    << " times");
   }
+  if (failedGridSearch > 0) {
+    ACTS_ERROR("Lookup grid missed a volume found by the detector "
+               << failedGridSearch << " times");
+  }
+
+  auto duration =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start);
+  m_nLookups += positions.size();
+  m_lookupTimeNs += duration.count();
+  ACTS_DEBUG("Performed " << positions.size() << " volume lookups in "
+                          << duration.count() * 1e-6 << " ms");
 
   return ProcessCode::SUCCESS;
 }
+
+ActsExamples::ProcessCode ActsExamples::VolumeAssociationTest::finalize() {
+  const double seconds = m_lookupTimeNs * 1e-9;
+  ACTS_INFO("Performed " << m_nLookups << " volume lookups"
+                         << (m_cfg.lookupGrid != nullptr ? " with lookup grid"
+                                                         : ""));
+  if (seconds > 0.) {
+    ACTS_INFO("Lookup throughput per thread: " << m_nLookups / seconds
+                                               << " lookups/s");
+  }
+  return ProcessCode::SUCCESS;
+}
@@ -0,0 +1,123 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Geometry/VolumeLookupGrid.hpp"
+
+#include "Acts/Detector/Detector.hpp"
+#include "Acts/Detector/DetectorVolume.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+ActsExamples::VolumeLookupGrid::VolumeLookupGrid(
+    const Config& cfg,
+    std::shared_ptr<const Acts::Experimental::Detector> detector,
+    const Acts::GeometryContext& gctx)
+    : m_cfg(cfg), m_detector(std::move(detector)) {
+  if (m_detector == nullptr) {
+    throw std::invalid_argument("Missing detector object");
+  }
+  if (m_cfg.binsR == 0 || m_cfg.binsPhi == 0 || m_cfg.binsZ == 0 ||
+      m_cfg.samplesPerBin == 0) {
+    throw std::invalid_argument("Number of bins and samples must be positive");
+  }
+  if (m_cfg.rMax <= 0. || m_cfg.zMax <= 0.) {
+    throw std::invalid_argument("Grid range must be positive");
+  }
+
+  const std::size_t nCells = m_cfg.binsR * m_cfg.binsPhi * m_cfg.binsZ;
+  const Acts::ActsScalar dR = m_cfg.rMax / m_cfg.binsR;
+  const Acts::ActsScalar dPhi = 2 * M_PI / m_cfg.binsPhi;
+  const Acts::ActsScalar dZ = 2 * m_cfg.zMax / m_cfg.binsZ;
+
+  // Relative sample positions within a cell, including the cell edges where
+  // the volume boundaries are expected
+  std::vector<Acts::ActsScalar> samples(m_cfg.samplesPerBin, 0.5);
+  if (m_cfg.samplesPerBin > 1) {
+    for (std::size_t is = 0; is < m_cfg.samplesPerBin; ++is) {
+      samples[is] = static_cast<Acts::ActsScalar>(is) /
+                    static_cast<Acts::ActsScalar>(m_cfg.samplesPerBin - 1);
+    }
+  }
+
+  std::vector<std::vector<const Acts::Experimental::DetectorVolume*>>
+      cellCandidates(nCells);
+
+  tbbWrap::parallel_for(
+      tbb::blocked_range<std::size_t>(0, nCells),
+      [&](const tbb::blocked_range<std::size_t>& range) {
+        for (std::size_t icell = range.begin(); icell != range.end();
+             ++icell) {
+          const std::size_t iz = icell % m_cfg.binsZ;
+          const std::size_t iphi = (icell / m_cfg.binsZ) % m_cfg.binsPhi;
+          const std::size_t ir = icell / (m_cfg.binsZ * m_cfg.binsPhi);
+
+          auto& candidates = cellCandidates[icell];
+          for (auto sr : samples) {
+            for (auto sphi : samples) {
+              for (auto sz : samples) {
+                Acts::ActsScalar r = (ir + sr) * dR;
+                Acts::ActsScalar phi = -M_PI + (iphi + sphi) * dPhi;
+                Acts::ActsScalar z = -m_cfg.zMax + (iz + sz) * dZ;
+                Acts::Vector3 position(r * std::cos(phi), r * std::sin(phi),
+                                       z);
+                auto volume = m_detector->findDetectorVolume(gctx, position);
+                if (volume != nullptr &&
+                    std::find(candidates.begin(), candidates.end(), volume) ==
+                        candidates.end()) {
+                  candidates.push_back(volume);
+                }
+              }
+            }
+          }
+        }
+      });
+
+  m_offsets.reserve(nCells + 1);
+  m_offsets.push_back(0);
+  for (const auto& candidates : cellCandidates) {
+    m_candidates.insert(m_candidates.end(), candidates.begin(),
+                        candidates.end());
+    m_offsets.push_back(m_candidates.size());
+  }
+}
+
+std::optional<std::size_t> ActsExamples::VolumeLookupGrid::cellIndex(
+    const Acts::Vector3& position) const {
+  const Acts::ActsScalar r = std::hypot(position.x(), position.y());
+  const Acts::ActsScalar z = position.z();
+  if (!(r < m_cfg.rMax) || !(std::abs(z) < m_cfg.zMax)) {
+    return std::nullopt;
+  }
+  const Acts::ActsScalar phi = std::atan2(position.y(), position.x());
+
+  auto bin = [](Acts::ActsScalar fraction, std::size_t nBins) {
+    return std::min(static_cast<std::size_t>(fraction * nBins), nBins - 1);
+  };
+  const std::size_t ir = bin(r / m_cfg.rMax, m_cfg.binsR);
+  const std::size_t iphi = bin((phi + M_PI) / (2 * M_PI), m_cfg.binsPhi);
+  const std::size_t iz = bin((z + m_cfg.zMax) / (2 * m_cfg.zMax), m_cfg.binsZ);
+  return (ir * m_cfg.binsPhi + iphi) * m_cfg.binsZ + iz;
+}
+
+const Acts::Experimental::DetectorVolume*
+ActsExamples::VolumeLookupGrid::findDetectorVolume(
+    const Acts::GeometryContext& gctx, const Acts::Vector3& position) const {
+  if (auto icell = cellIndex(position); icell.has_value()) {
+    for (std::size_t ic = m_offsets[*icell]; ic < m_offsets[*icell + 1];
+         ++ic) {
+      if (m_candidates[ic]->inside(gctx, position)) {
+        return m_candidates[ic];
+      }
+    }
+  }
+  return m_detector->findDetectorVolume(gctx, position);
+}
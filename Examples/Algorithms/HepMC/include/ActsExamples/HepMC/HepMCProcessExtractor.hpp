@@ -45,6 +45,8 @@ class HepMCProcessExtractor final : public ActsExamples::IAlgorithm {
     int absPdgMax = 2212;
     /// Minimum momentum of considered particles
     double pMin = 50. * Acts::UnitConstants::MeV;
+    /// Extract the processes of the input events in parallel
+    bool parallel = false;
   };
 
   /// Constructor
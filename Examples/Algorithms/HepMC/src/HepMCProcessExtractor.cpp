@@ -10,8 +10,12 @@
 
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 #include "ActsExamples/Io/HepMC3/HepMC3Particle.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <cstdint>
+#include <optional>
 #include <stdexcept>
+#include <unordered_map>
 
 #include <HepMC3/GenEvent.h>
 #include <HepMC3/GenParticle.h>
@@ -19,33 +23,70 @@
 
 namespace {
 
-/// @brief This method searches for an outgoing particle from a vertex
+/// @brief Index of the particles of a HepMC event, built in a single pass.
 ///
-/// @param [in] vertex The vertex
-/// @param [in] id The track ID of the particle
-///
-/// @return The particle pointer if found, else nullptr
-HepMC3::ConstGenParticlePtr searchProcessParticleById(
-    const HepMC3::ConstGenVertexPtr& vertex, const int id) {
-  // Loop over all outgoing particles
-  for (const auto& particle : vertex->particles_out()) {
-    const int trackid =
-        particle->attribute<HepMC3::IntAttribute>("TrackID")->value();
-    // Compare ID
-    if (trackid == id) {
-      return particle;
+/// The string keyed attributes of HepMC are parsed on every access, so the
+/// track IDs are decoded once and the outgoing particles of each vertex are
+/// indexed by their track ID.
+struct ParticleIndex {
+  /// Track ID per particle, indexed by the HepMC particle id - 1
+  std::vector<std::optional<int>> trackIds;
+  /// Outgoing particle per vertex and track ID
+  std::unordered_map<std::uint64_t, HepMC3::ConstGenParticlePtr> outgoing;
+
+  explicit ParticleIndex(const HepMC3::GenEvent& event) {
+    trackIds.reserve(event.particles().size());
+    for (const auto& particle : event.particles()) {
+      auto trackId = particle->attribute<HepMC3::IntAttribute>("TrackID");
+      trackIds.push_back(trackId ? std::optional<int>(trackId->value())
+                                 : std::nullopt);
+    }
+    outgoing.reserve(event.particles().size());
+    for (const auto& vertex : event.vertices()) {
+      for (const auto& particle : vertex->particles_out()) {
+        if (auto id = trackId(particle); id.has_value()) {
+          // Keep the first particle like the search over the vertex
+          outgoing.try_emplace(key(vertex, *id), particle);
+        }
+      }
     }
   }
-  return nullptr;
-}
+
+  /// The track ID of a particle if it has one
+  std::optional<int> trackId(
+      const HepMC3::ConstGenParticlePtr& particle) const {
+    return trackIds.at(particle->id() - 1);
+  }
+
+  /// @brief This method searches for an outgoing particle from a vertex
+  ///
+  /// @param [in] vertex The vertex
+  /// @param [in] id The track ID of the particle
+  ///
+  /// @return The particle pointer if found, else nullptr
+  HepMC3::ConstGenParticlePtr outgoingParticle(
+      const HepMC3::ConstGenVertexPtr& vertex, const int id) const {
+    auto it = outgoing.find(key(vertex, id));
+    return it != outgoing.end() ? it->second : nullptr;
+  }
+
+  static std::uint64_t key(const HepMC3::ConstGenVertexPtr& vertex,
+                           const int id) {
+    // HepMC vertex ids are negative
+    return (static_cast<std::uint64_t>(-vertex->id()) << 32) |
+           static_cast<std::uint32_t>(id);
+  }
+};
 
 /// @brief This method collects the material in X_0 and L_0 a particle has
 /// passed from its creation up to a certain vertex.
 ///
+/// @param [in] index The particle index of the event
 /// @param [in] vertex The end vertex of the collection
 /// @param [in] id The track ID
 /// @param [in, out] particle The particle that get the passed material attached
-void setPassedMaterial(const HepMC3::ConstGenVertexPtr& vertex, const int id,
+void setPassedMaterial(const ParticleIndex& index,
+                       const HepMC3::ConstGenVertexPtr& vertex, const int id,
                        ActsExamples::SimParticle& particle) {
   double x0 = 0.;
   double l0 = 0.;
@@ -53,11 +94,7 @@ void setPassedMaterial(const HepMC3::ConstGenVertexPtr& vertex, const int id,
   HepMC3::ConstGenVertexPtr currentVertex = vertex;
   // Loop backwards and test whether the track still exists
   while (currentVertex && !currentVertex->particles_in().empty() &&
-         currentVertex->particles_in()[0]->attribute<HepMC3::IntAttribute>(
-             "TrackID") &&
-         currentVertex->particles_in()[0]
-                 ->attribute<HepMC3::IntAttribute>("TrackID")
-                 ->value() == id) {
+         index.trackId(currentVertex->particles_in()[0]) == id) {
     // Get the step length
     currentParticle = currentVertex->particles_in()[0];
     const double stepLength =
@@ -79,17 +116,19 @@ void setPassedMaterial(const HepMC3::ConstGenVertexPtr& vertex, const int id,
 /// @brief This function collects outgoing particles from a vertex while keeping
 /// track of the future of the ingoing particle.
 ///
+/// @param [in] index The particle index of the event
 /// @param [in] vertex The vertex
 /// @param [in] trackID The track ID of the ingoing particle
 ///
 /// @return Vector containing the outgoing particles from a vertex
 std::vector<ActsExamples::SimParticle> selectOutgoingParticles(
-    const HepMC3::ConstGenVertexPtr& vertex, const int trackID) {
+    const ParticleIndex& index, const HepMC3::ConstGenVertexPtr& vertex,
+    const int trackID) {
   std::vector<ActsExamples::SimParticle> finalStateParticles;
 
   // Identify the ingoing particle in the outgoing particles
   HepMC3::ConstGenParticlePtr procPart =
-      searchProcessParticleById(vertex, trackID);
+      index.outgoingParticle(vertex, trackID);
 
   // Test whether this particle survives or dies
   HepMC3::ConstGenVertexPtr endVertex = procPart->end_vertex();
@@ -104,9 +143,7 @@ std::vector<ActsExamples::SimParticle> selectOutgoingParticles(
     // Store the leftovers if it dies
     for (const HepMC3::ConstGenParticlePtr& procPartOut :
          endVertex->particles_out()) {
-      if (procPartOut->attribute<HepMC3::IntAttribute>("TrackID")->value() ==
-              trackID &&
-          procPartOut->end_vertex()) {
+      if (index.trackId(procPartOut) == trackID && procPartOut->end_vertex()) {
         for (const HepMC3::ConstGenParticlePtr& dyingPartOut :
              procPartOut->end_vertex()->particles_out()) {
           finalStateParticles.push_back(
@@ -126,7 +163,7 @@ std::vector<ActsExamples::SimParticle> selectOutgoingParticles(
       const HepMC3::FourVector& pos4 = endVertex->position();
       const int id = stoi(att.substr(att.find("-") + 1));
       HepMC3::ConstGenParticlePtr genParticle =
-          searchProcessParticleById(endVertex, id);
+          index.outgoingParticle(endVertex, id);
       ActsFatras::Barcode barcode = ActsFatras::Barcode().setParticle(id);
       auto pid = static_cast<Acts::PdgParticle>(genParticle->pid());
 
@@ -145,6 +182,69 @@ std::vector<ActsExamples::SimParticle> selectOutgoingParticles(
   return finalStateParticles;
 }
 
+/// @brief This method extracts the requested process from an event.
+///
+/// The attributes of all vertices are scanned in a single pass over the
+/// attribute table of the event instead of per vertex. The selected process
+/// vertex is the first vertex of the event carrying the process, as for the
+/// search over the vertices.
+///
+/// @param [in] cfg Configuration of the extraction
+/// @param [in] event The HepMC event
+///
+/// @return The extracted process
+ActsExamples::ExtractedSimulationProcess extractProcess(
+    const ActsExamples::HepMCProcessExtractor::Config& cfg,
+    const HepMC3::GenEvent& event) {
+  // Get the initial particle
+  HepMC3::ConstGenParticlePtr initialParticle = event.particles()[0];
+  ActsExamples::SimParticle simParticle =
+      ActsExamples::HepMC3Particle::particle(initialParticle);
+
+  // Search the process vertex. The attribute names are sorted, so the first
+  // match of a vertex is also its first attribute carrying the process.
+  int processVertexId = 0;
+  const std::string* processAttribute = nullptr;
+  const auto attributes = event.attributes();
+  std::string value;
+  for (const auto& [name, attributesById] : attributes) {
+    for (const auto& [id, attribute] : attributesById) {
+      // Vertex ids are negative and count down in the order of the vertices
+      if (id >= 0 || (processAttribute != nullptr && id <= processVertexId) ||
+          attribute == nullptr) {
+        continue;
+      }
+      value.clear();
+      attribute->to_string(value);
+      if (value.find(cfg.extractionProcess) != std::string::npos) {
+        processVertexId = id;
+        processAttribute = &name;
+      }
+    }
+  }
+
+  // Get the final state particles
+  ActsExamples::SimParticle particleToInteraction;
+  std::vector<ActsExamples::SimParticle> finalStateParticles;
+  if (processAttribute != nullptr) {
+    const ParticleIndex index(event);
+    const HepMC3::ConstGenVertexPtr vertex =
+        event.vertices().at(-processVertexId - 1);
+    const int procID =
+        stoi(processAttribute->substr(processAttribute->find("-") + 1));
+    // Get the particle before the interaction
+    particleToInteraction =
+        ActsExamples::HepMC3Particle::particle(vertex->particles_in()[0]);
+    // Attach passed material to the particle
+    setPassedMaterial(index, vertex, procID, particleToInteraction);
+    // Record the final state particles
+    finalStateParticles = selectOutgoingParticles(index, vertex, procID);
+  }
+
+  return ActsExamples::ExtractedSimulationProcess{
+      simParticle, particleToInteraction, finalStateParticles};
+}
+
 /// @brief This method filters and sorts the recorded interactions.
 ///
 /// @param [in] cfg Configuration of the filtering
@@ -199,48 +299,28 @@ ActsExamples::HepMCProcessExtractor::HepMCProcessExtractor(
 ActsExamples::ProcessCode ActsExamples::HepMCProcessExtractor::execute(
     const ActsExamples::AlgorithmContext& context) const {
   // Retrieve the initial particles
-  const auto events = m_inputEvents(context);
-
-  ActsExamples::ExtractedSimulationProcessContainer fractions;
-  for (const HepMC3::GenEvent& event : events) {
-    // Fast exit
-    if (event.particles().empty() || event.vertices().empty()) {
-      break;
-    }
+  const auto& events = m_inputEvents(context);
 
-    // Get the initial particle
-    HepMC3::ConstGenParticlePtr initialParticle = event.particles()[0];
-    ActsExamples::SimParticle simParticle =
-        HepMC3Particle::particle(initialParticle);
+  // Events are processed up to the first empty one
+  std::size_t nEvents = 0;
+  while (nEvents < events.size() && !events[nEvents].particles().empty() &&
+         !events[nEvents].vertices().empty()) {
+    ++nEvents;
+  }
 
-    // Get the final state particles
-    ActsExamples::SimParticle particleToInteraction;
-    std::vector<ActsExamples::SimParticle> finalStateParticles;
-    // Search the process vertex
-    bool vertexFound = false;
-    for (const auto& vertex : event.vertices()) {
-      const std::vector<std::string> attributes = vertex->attribute_names();
-      for (const auto& attribute : attributes) {
-        if (vertex->attribute_as_string(attribute).find(
-                m_cfg.extractionProcess) != std::string::npos) {
-          const int procID = stoi(attribute.substr(attribute.find("-") + 1));
-          // Get the particle before the interaction
-          particleToInteraction =
-              HepMC3Particle::particle(vertex->particles_in()[0]);
-          // Attach passed material to the particle
-          setPassedMaterial(vertex, procID, particleToInteraction);
-          // Record the final state particles
-          finalStateParticles = selectOutgoingParticles(vertex, procID);
-          vertexFound = true;
-          break;
-        }
-      }
-      if (vertexFound) {
-        break;
-      }
+  ActsExamples::ExtractedSimulationProcessContainer fractions(nEvents);
+  if (m_cfg.parallel) {
+    tbbWrap::parallel_for(tbb::blocked_range<std::size_t>(0, nEvents),
+                          [&](const tbb::blocked_range<std::size_t>& range) {
+                            for (std::size_t i = range.begin();
+                                 i != range.end(); ++i) {
+                              fractions[i] = extractProcess(m_cfg, events[i]);
+                            }
+                          });
+  } else {
+    for (std::size_t i = 0; i < nEvents; ++i) {
+      fractions[i] = extractProcess(m_cfg, events[i]);
     }
-    fractions.push_back(ActsExamples::ExtractedSimulationProcess{
-        simParticle, particleToInteraction, finalStateParticles});
   }
 
   // Filter and sort the record
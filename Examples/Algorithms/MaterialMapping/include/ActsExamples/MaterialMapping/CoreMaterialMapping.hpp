@@ -76,13 +76,13 @@ class CoreMaterialMapping : public IAlgorithm {
 
   std::unique_ptr<Acts::MaterialMapper::State> m_mappingState{nullptr};
 
-  ReadDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
+  ReadDataHandle<std::vector<Acts::RecordedMaterialTrack>>
       m_inputMaterialTracks{this, "InputMaterialTracks"};
 
-  WriteDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
+  WriteDataHandle<std::vector<Acts::RecordedMaterialTrack>>
       m_outputMappedMaterialTracks{this, "OutputMappedMaterialTracks"};
 
-  WriteDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
+  WriteDataHandle<std::vector<Acts::RecordedMaterialTrack>>
       m_outputUnmappedMaterialTracks{this, "OutputUnmappedMaterialTracks"};
 };
 
@@ -27,7 +27,6 @@
 #include <map>
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -128,9 +127,9 @@ class MaterialMapping : public IAlgorithm {
       m_mappingStateVol;  //!< Material mapping state
                           //
 
-  ReadDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
+  ReadDataHandle<std::vector<Acts::RecordedMaterialTrack>>
       m_inputMaterialTracks{this, "InputMaterialTracks"};
-  WriteDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
+  WriteDataHandle<std::vector<Acts::RecordedMaterialTrack>>
       m_outputMaterialTracks{this, "OutputMaterialTracks"};
 };
 
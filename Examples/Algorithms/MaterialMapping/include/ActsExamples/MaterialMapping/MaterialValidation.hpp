@@ -19,6 +19,9 @@
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
 
+#include <atomic>
+#include <cstddef>
+
 namespace ActsExamples {
 
 /// @class MaterialValidation
@@ -48,6 +51,12 @@ class MaterialValidation : public IAlgorithm {
 
     /// Output collection name
     std::string outputMaterialTracks = "material_tracks";
+
+    /// Record the tracks of an event in parallel. Every track uses its own
+    /// random number stream derived from the event and the track index, so
+    /// the output does not depend on the number of threads. It differs from
+    /// the output of the serial mode, which uses one stream for all tracks.
+    bool parallel = false;
   };
 
   /// Constructor
@@ -67,13 +76,27 @@ class MaterialValidation : public IAlgorithm {
   ActsExamples::ProcessCode execute(
       const AlgorithmContext& context) const override;
 
+  /// Report the validation throughput
+  ActsExamples::ProcessCode finalize() override;
+
   /// Readonly access to the config
   const Config& config() const { return m_cfg; }
 
  private:
+  /// Generate a random direction and record the material along it
+  ///
+  /// @param context The algorithm context for event consistency
+  /// @param rng The random number generator for the direction
+  Acts::RecordedMaterialTrack recordTrack(const AlgorithmContext& context,
+                                          RandomEngine& rng) const;
+
   Config m_cfg;  //!< internal config object
 
-  WriteDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
+  /// Number of recorded tracks and the time spent recording them
+  mutable std::atomic<std::size_t> m_nTracks{0};
+  mutable std::atomic<std::size_t> m_recordingTimeNs{0};
+
+  WriteDataHandle<std::vector<Acts::RecordedMaterialTrack>>
       m_outputMaterialTracks{this, "OutputMaterialTracks"};
 };
 
@@ -13,7 +13,7 @@
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
 
 #include <stdexcept>
-#include <unordered_map>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -47,28 +47,26 @@ CoreMaterialMapping::~CoreMaterialMapping() {
 ProcessCode CoreMaterialMapping::execute(
     const AlgorithmContext& context) const {
   // Take the collection from the EventStore: input collection
-  std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>
-      mtrackCollection = m_inputMaterialTracks(context);
+  std::vector<Acts::RecordedMaterialTrack> mtrackCollection =
+      m_inputMaterialTracks(context);
 
   // Write the output collections to the Event store : mapped and unmapped
-  std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>
-      mappedTrackCollection;
+  std::vector<Acts::RecordedMaterialTrack> mappedTrackCollection;
+  mappedTrackCollection.reserve(mtrackCollection.size());
 
-  std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>
-      unmappedTrackCollection;
+  std::vector<Acts::RecordedMaterialTrack> unmappedTrackCollection;
+  unmappedTrackCollection.reserve(mtrackCollection.size());
 
   // To make it work with the framework needs a lock guard
   auto mappingState =
       const_cast<Acts::MaterialMapper::State*>(m_mappingState.get());
 
-  for (auto& [idTrack, mTrack] : mtrackCollection) {
+  for (auto& mTrack : mtrackCollection) {
     auto [mapped, unmapped] = m_cfg.materialMapper->mapMaterial(
         *mappingState, context.geoContext, context.magFieldContext, mTrack);
 
-    mappedTrackCollection.emplace_hint(mappedTrackCollection.end(), idTrack,
-                                       mapped);
-    unmappedTrackCollection.emplace_hint(unmappedTrackCollection.end(), idTrack,
-                                         unmapped);
+    mappedTrackCollection.push_back(std::move(mapped));
+    unmappedTrackCollection.push_back(std::move(unmapped));
   }
 
   // Write the mapped and unmapped material tracks to the output
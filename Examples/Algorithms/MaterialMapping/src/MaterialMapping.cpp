@@ -13,7 +13,7 @@
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
 
 #include <stdexcept>
-#include <unordered_map>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -99,14 +99,14 @@ ProcessCode MaterialMapping::finalize() {
 
 ProcessCode MaterialMapping::execute(const AlgorithmContext& context) const {
   // Take the collection from the EventStore
-  std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>
-      mtrackCollection = m_inputMaterialTracks(context);
+  std::vector<Acts::RecordedMaterialTrack> mtrackCollection =
+      m_inputMaterialTracks(context);
 
   if (m_cfg.materialSurfaceMapper) {
     // To make it work with the framework needs a lock guard
     auto mappingState =
         const_cast<Acts::SurfaceMaterialMapper::State*>(&m_mappingState);
-    for (auto& [idTrack, mTrack] : mtrackCollection) {
+    for (auto& mTrack : mtrackCollection) {
       // Map this one onto the geometry
       m_cfg.materialSurfaceMapper->mapMaterialTrack(*mappingState, mTrack);
     }
@@ -116,7 +116,7 @@ ProcessCode MaterialMapping::execute(const AlgorithmContext& context) const {
     auto mappingState =
         const_cast<Acts::VolumeMaterialMapper::State*>(&m_mappingStateVol);
 
-    for (auto& [idTrack, mTrack] : mtrackCollection) {
+    for (auto& mTrack : mtrackCollection) {
       // Map this one onto the geometry
       m_cfg.materialVolumeMapper->mapMaterialTrack(*mappingState, mTrack);
     }
@@ -9,8 +9,11 @@
 #include "ActsExamples/MaterialMapping/MaterialValidation.hpp"
 
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <chrono>
 #include <stdexcept>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -29,42 +32,72 @@ MaterialValidation::MaterialValidation(const MaterialValidation::Config& cfg,
   }
 }
 
-ProcessCode MaterialValidation::execute(const AlgorithmContext& context) const {
-  // Create a random number generator
-  ActsExamples::RandomEngine rng =
-      m_cfg.randomNumberSvc->spawnGenerator(context);
-
+Acts::RecordedMaterialTrack MaterialValidation::recordTrack(
+    const AlgorithmContext& context, RandomEngine& rng) const {
   // Setup random number distributions for some quantities
   std::uniform_real_distribution<double> phiDist(m_cfg.phiRange.first,
                                                  m_cfg.phiRange.second);
   std::uniform_real_distribution<double> etaDist(m_cfg.etaRange.first,
                                                  m_cfg.etaRange.second);
 
-  // The output recorded material track collection
-  std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>
-      recordedMaterialTracks;
-
-  // Loop over the number of tracks
-  for (std::size_t iTrack = 0; iTrack < m_cfg.ntracks; ++iTrack) {
-    // Generate a random phi and eta
-    Acts::ActsScalar phi = phiDist(rng);
-    Acts::ActsScalar eta = etaDist(rng);
-    Acts::ActsScalar theta = 2 * std::atan(std::exp(-eta));
-    Acts::Vector3 direction(std::cos(phi) * std::sin(theta),
-                            std::sin(phi) * std::sin(theta), std::cos(theta));
-
-    // Record the material
-    auto rMaterial = m_cfg.materialValidater->recordMaterial(
-        context.geoContext, context.magFieldContext, m_cfg.startPosition,
-        direction);
-
-    recordedMaterialTracks.emplace_hint(recordedMaterialTracks.end(), iTrack,
-                                        rMaterial);
+  // Generate a random phi and eta
+  Acts::ActsScalar phi = phiDist(rng);
+  Acts::ActsScalar eta = etaDist(rng);
+  Acts::ActsScalar theta = 2 * std::atan(std::exp(-eta));
+  Acts::Vector3 direction(std::cos(phi) * std::sin(theta),
+                          std::sin(phi) * std::sin(theta), std::cos(theta));
+
+  // Record the material
+  return m_cfg.materialValidater->recordMaterial(
+      context.geoContext, context.magFieldContext, m_cfg.startPosition,
+      direction);
+}
+
+ProcessCode MaterialValidation::execute(const AlgorithmContext& context) const {
+  auto start = std::chrono::steady_clock::now();
+
+  // The recorded material tracks in track index order
+  std::vector<Acts::RecordedMaterialTrack> tracks(m_cfg.ntracks);
+
+  if (m_cfg.parallel) {
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, m_cfg.ntracks),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          for (std::size_t iTrack = range.begin(); iTrack != range.end();
+               ++iTrack) {
+            auto rng = m_cfg.randomNumberSvc->spawnGenerator(context, iTrack);
+            tracks[iTrack] = recordTrack(context, rng);
+          }
+        });
+  } else {
+    // Create a random number generator
+    ActsExamples::RandomEngine rng =
+        m_cfg.randomNumberSvc->spawnGenerator(context);
+
+    // Loop over the number of tracks
+    for (std::size_t iTrack = 0; iTrack < m_cfg.ntracks; ++iTrack) {
+      tracks[iTrack] = recordTrack(context, rng);
+    }
   }
 
+  auto stop = std::chrono::steady_clock::now();
+  m_nTracks += m_cfg.ntracks;
+  m_recordingTimeNs +=
+      std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+          .count();
+
   // Write the mapped and unmapped material tracks to the output
-  m_outputMaterialTracks(context, std::move(recordedMaterialTracks));
+  m_outputMaterialTracks(context, std::move(tracks));
+
+  return ProcessCode::SUCCESS;
+}
 
+ProcessCode MaterialValidation::finalize() {
+  const std::size_t nTracks = m_nTracks;
+  const double seconds = m_recordingTimeNs * 1e-9;
+  ACTS_INFO("Validated " << nTracks << " tracks in " << seconds << " s ("
+                         << (seconds > 0. ? nTracks / seconds : 0.)
+                         << " tracks/s)");
   return ProcessCode::SUCCESS;
 }
 
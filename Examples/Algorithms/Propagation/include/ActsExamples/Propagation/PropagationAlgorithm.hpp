@@ -13,6 +13,7 @@
 #include "Acts/Propagator/MaterialInteractor.hpp"
 #include "Acts/Propagator/detail/SteppingLogger.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/PropagationSteps.hpp"
 #include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
@@ -20,7 +21,7 @@
 
 #include <memory>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -66,6 +67,10 @@ class PropagationAlgorithm : public IAlgorithm {
     double maxStepSize = 5 * Acts::UnitConstants::m;
     /// Switch covariance transport on
     bool covarianceTransport = false;
+    /// Propagate the tracks of an event in parallel. Every task collects the
+    /// steps of its tracks in its own arena; the arenas are merged in input
+    /// order, so the output does not depend on the number of threads.
+    bool parallel = false;
     /// Input track parameters
     std::string inputTrackParameters = "InputTrackParameters";
     /// The step collection to be stored
@@ -94,10 +99,10 @@ class PropagationAlgorithm : public IAlgorithm {
   ReadDataHandle<TrackParametersContainer> m_inputTrackParameters{
       this, "InputTrackParameters"};
 
-  WriteDataHandle<std::vector<std::vector<Acts::detail::Step>>>
-      m_outputPropagationSteps{this, "OutputPropagationSteps"};
+  WriteDataHandle<PropagationStepContainer> m_outputPropagationSteps{
+      this, "OutputPropagationSteps"};
 
-  WriteDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
+  WriteDataHandle<std::vector<Acts::RecordedMaterialTrack>>
       m_outputMaterialTracks{this, "RecordedMaterial"};
 };
 
@@ -8,11 +8,16 @@
 
 #include "ActsExamples/Propagation/PropagationAlgorithm.hpp"
 
-#include "Acts/Utilities/Enumerate.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Propagation/PropagatorInterface.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <cstddef>
+#include <map>
+#include <mutex>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -24,18 +29,17 @@ ProcessCode PropagationAlgorithm::execute(
   ACTS_DEBUG("Propagating " << inputTrackParameters.size()
                             << " input trackparameters");
 
-  // Output : the propagation steps
-  std::vector<std::vector<Acts::detail::Step>> propagationSteps;
-  propagationSteps.reserve(inputTrackParameters.size());
-
-  // Output (optional): the recorded material
-  std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>
-      recordedMaterialTracks;
+  // Output (optional): the recorded material, one entry per input track
+  std::vector<Acts::RecordedMaterialTrack> materialTracks;
   if (m_cfg.recordMaterialInteractions) {
-    recordedMaterialTracks.reserve(inputTrackParameters.size());
+    materialTracks.resize(inputTrackParameters.size());
   }
 
-  for (const auto [it, parameters] : Acts::enumerate(inputTrackParameters)) {
+  // Propagate a single track, the steps are returned and the recorded
+  // material is stored in the slot of the track
+  auto propagateTrack = [&](std::size_t it) {
+    const auto& parameters = inputTrackParameters[it];
+
     // In case covariance transport is not desired, it has to be stripped
     // off the input parameters
     PropagationOutput pOutput =
@@ -48,25 +52,68 @@ ProcessCode PropagationAlgorithm::execute(
                                   parameters.parameters(), std::nullopt,
                                   parameters.particleHypothesis()));
 
-    // Position / momentum for the output writing
-    Acts::Vector3 position = parameters.position(context.geoContext);
-    Acts::Vector3 direction = parameters.direction();
-
-    // Record the propagator steps
-    propagationSteps.push_back(std::move(pOutput.first));
     if (m_cfg.recordMaterialInteractions) {
+      // Position / momentum for the output writing
+      Acts::Vector3 position = parameters.position(context.geoContext);
+      Acts::Vector3 direction = parameters.direction();
       // Record the material information
-      recordedMaterialTracks.emplace(
-          it, std::make_pair(std::make_pair(position, direction),
-                             std::move(pOutput.second)));
+      materialTracks[it] = std::make_pair(std::make_pair(position, direction),
+                                          std::move(pOutput.second));
+    }
+    return std::move(pOutput.first);
+  };
+
+  // Output : the propagation steps of all tracks in one flat buffer
+  PropagationStepContainer propagationSteps;
+
+  if (!m_cfg.parallel) {
+    for (std::size_t it = 0; it < inputTrackParameters.size(); ++it) {
+      propagationSteps.push_back(propagateTrack(it));
+    }
+  } else {
+    // Steps of consecutive tracks, collected by one task
+    struct StepArena {
+      std::vector<Acts::detail::Step> steps;
+      std::vector<std::size_t> nSteps;
+    };
+    // The arenas of all tasks keyed by their first track
+    std::map<std::size_t, StepArena> arenas;
+    std::mutex arenasMutex;
+
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, inputTrackParameters.size()),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          StepArena arena;
+          arena.nSteps.reserve(range.size());
+          for (std::size_t it = range.begin(); it != range.end(); ++it) {
+            auto steps = propagateTrack(it);
+            arena.steps.insert(arena.steps.end(), steps.begin(), steps.end());
+            arena.nSteps.push_back(steps.size());
+          }
+          std::lock_guard<std::mutex> guard(arenasMutex);
+          arenas.emplace(range.begin(), std::move(arena));
+        });
+
+    // The arenas cover consecutive tracks, so merging them in the order of
+    // their first track gives the input order for any number of threads
+    std::size_t nSteps = 0;
+    for (const auto& [begin, arena] : arenas) {
+      nSteps += arena.steps.size();
+    }
+    propagationSteps.reserve(inputTrackParameters.size(), nSteps);
+    for (const auto& [begin, arena] : arenas) {
+      propagationSteps.append(arena.steps, arena.nSteps);
     }
   }
+
+  ACTS_DEBUG("Recorded " << propagationSteps.totalSteps() << " steps");
+
   // Write the propagation step data to the event store
   m_outputPropagationSteps(context, std::move(propagationSteps));
 
   // Write the recorded material to the event store
   if (m_cfg.recordMaterialInteractions) {
-    m_outputMaterialTracks(context, std::move(recordedMaterialTracks));
+    m_outputMaterialTracks(context, std::move(materialTracks));
   }
   return ProcessCode::SUCCESS;
 }
@@ -126,6 +126,15 @@ class TrackFindingAlgorithm final : public IAlgorithm {
     bool stayOnSeed = false;
     /// Compute shared hit information
     bool computeSharedHits = false;
+    /// Avoid the intermediate deep copies of the track candidates.
+    /// If enabled, the track states written by the CKF are used in place
+    /// whenever a branch does not share its states with another branch, and
+    /// only the surviving tracks are copied into the output container.
+    bool lightweightTrackCandidates = false;
+    /// Look up the source links of a surface in a per-module table built for
+    /// every event instead of a binary search over all source links. The
+    /// table only pays off if the source links fit in the cache.
+    bool sourceLinkModuleIndex = false;
 
     // Pixel and strip volume ids to be used for maxPixel/StripHoles cuts
     std::set<Acts::GeometryIdentifier::Value> pixelVolumes;
@@ -153,10 +162,6 @@ class TrackFindingAlgorithm final : public IAlgorithm {
   const Config& config() const { return m_cfg; }
 
  private:
-  template <typename source_link_accessor_container_t>
-  void computeSharedHits(const source_link_accessor_container_t& sourcelinks,
-                         TrackContainer& tracks) const;
-
   ActsExamples::ProcessCode finalize() override;
 
  private:
@@ -189,56 +194,4 @@ class TrackFindingAlgorithm final : public IAlgorithm {
       }};
 };
 
-// TODO this is somewhat duplicated in AmbiguityResolutionAlgorithm.cpp
-// TODO we should make a common implementation in the core at some point
-template <typename source_link_accessor_container_t>
-void TrackFindingAlgorithm::computeSharedHits(
-    const source_link_accessor_container_t& sourceLinks,
-    TrackContainer& tracks) const {
-  // Compute shared hits from all the reconstructed tracks
-  // Compute nSharedhits and Update ckf results
-  // hit index -> list of multi traj indexes [traj, meas]
-
-  std::vector<std::size_t> firstTrackOnTheHit(
-      sourceLinks.size(), std::numeric_limits<std::size_t>::max());
-  std::vector<std::size_t> firstStateOnTheHit(
-      sourceLinks.size(), std::numeric_limits<std::size_t>::max());
-
-  for (auto track : tracks) {
-    for (auto state : track.trackStatesReversed()) {
-      if (!state.typeFlags().test(Acts::TrackStateFlag::MeasurementFlag)) {
-        continue;
-      }
-
-      std::size_t hitIndex = state.getUncalibratedSourceLink()
-                                 .template get<IndexSourceLink>()
-                                 .index();
-
-      // Check if hit not already used
-      if (firstTrackOnTheHit.at(hitIndex) ==
-          std::numeric_limits<std::size_t>::max()) {
-        firstTrackOnTheHit.at(hitIndex) = track.index();
-        firstStateOnTheHit.at(hitIndex) = state.index();
-        continue;
-      }
-
-      // if already used, control if first track state has been marked
-      // as shared
-      int indexFirstTrack = firstTrackOnTheHit.at(hitIndex);
-      int indexFirstState = firstStateOnTheHit.at(hitIndex);
-
-      auto firstState = tracks.getTrack(indexFirstTrack)
-                            .container()
-                            .trackStateContainer()
-                            .getTrackState(indexFirstState);
-      if (!firstState.typeFlags().test(Acts::TrackStateFlag::SharedHitFlag)) {
-        firstState.typeFlags().set(Acts::TrackStateFlag::SharedHitFlag);
-      }
-
-      // Decorate this track state
-      state.typeFlags().set(Acts::TrackStateFlag::SharedHitFlag);
-    }
-  }
-}
-
 }  // namespace ActsExamples
@@ -41,32 +41,19 @@
 #include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Utilities/SharedHits.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <ostream>
 #include <stdexcept>
 #include <system_error>
-#include <unordered_map>
 #include <utility>
-
-#include <boost/functional/hash.hpp>
-
-// Specialize std::hash for SeedIdentifier
-// This is required to use SeedIdentifier as a key in an `std::unordered_map`.
-template <class T, std::size_t N>
-struct std::hash<std::array<T, N>> {
-  std::size_t operator()(const std::array<T, N>& array) const {
-    std::hash<T> hasher;
-    std::size_t result = 0;
-    for (auto&& element : array) {
-      boost::hash_combine(result, hasher(element));
-    }
-    return result;
-  }
-};
+#include <vector>
 
 namespace ActsExamples {
 
@@ -143,35 +130,133 @@ SeedIdentifier makeSeedIdentifier(const SimSeed& seed) {
   return result;
 }
 
-/// Visit all possible seed identifiers of a track.
+/// Index of the seeds used for deduplication.
 ///
-/// @param track The track to visit the seed identifiers of.
-/// @param visitor The visitor to call for each seed identifier.
-template <typename Visitor>
-void visitSeedIdentifiers(const TrackProxy& track, Visitor visitor) {
-  // first we collect the source link indices of the track states
-  std::vector<Index> sourceLinkIndices;
-  sourceLinkIndices.reserve(track.nMeasurements());
-  for (const auto& trackState : track.trackStatesReversed()) {
-    if (!trackState.hasUncalibratedSourceLink()) {
-      continue;
+/// The seeds are stored in a compressed sparse row (CSR) layout keyed by the
+/// index of their bottom measurement. Marking the seeds covered by a track
+/// then only touches the seeds that start on one of the track measurements
+/// instead of probing all possible measurement triplets of the track.
+class SeedDeduplicationIndex {
+ public:
+  /// Build the index.
+  ///
+  /// @param seeds The seeds to index.
+  /// @param nMeasurements The number of measurements in the event.
+  SeedDeduplicationIndex(const SimSeedContainer& seeds,
+                         std::size_t nMeasurements)
+      : m_offsets(nMeasurements + 1, 0),
+        m_entries(seeds.size()),
+        m_discovered(seeds.size(), false) {
+    std::vector<SeedIdentifier> identifiers;
+    identifiers.reserve(seeds.size());
+    for (const auto& seed : seeds) {
+      identifiers.push_back(makeSeedIdentifier(seed));
+      ++m_offsets.at(identifiers.back()[0] + 1);
+    }
+    for (std::size_t i = 1; i < m_offsets.size(); ++i) {
+      m_offsets[i] += m_offsets[i - 1];
+    }
+
+    std::vector<std::size_t> fill(m_offsets.begin(), m_offsets.end() - 1);
+    for (std::size_t iSeed = 0; iSeed < identifiers.size(); ++iSeed) {
+      const SeedIdentifier& identifier = identifiers[iSeed];
+      m_entries[fill[identifier[0]]++] = {identifier[1], identifier[2],
+                                          static_cast<Index>(iSeed)};
     }
-    const Acts::SourceLink& sourceLink = trackState.getUncalibratedSourceLink();
-    sourceLinkIndices.push_back(sourceLink.get<IndexSourceLink>().index());
   }
 
-  // then we iterate over all possible triplets and form seed identifiers
-  for (std::size_t i = 0; i < sourceLinkIndices.size(); ++i) {
-    for (std::size_t j = i + 1; j < sourceLinkIndices.size(); ++j) {
-      for (std::size_t k = j + 1; k < sourceLinkIndices.size(); ++k) {
-        // Putting them into reverse order (k, j, i) to compensate for the
-        // `trackStatesReversed` above.
-        visitor({sourceLinkIndices.at(k), sourceLinkIndices.at(j),
-                 sourceLinkIndices.at(i)});
+  /// Check if a seed was already covered by a previously found track.
+  ///
+  /// @param iSeed The index of the seed in the input seed container.
+  bool isDiscovered(std::size_t iSeed) const { return m_discovered.at(iSeed); }
+
+  /// Mark all seeds which are covered by a track.
+  ///
+  /// A seed is covered if its bottom, middle and top measurements appear on
+  /// the track in this order.
+  ///
+  /// @param track The track to mark the seeds of.
+  void markCovered(const TrackProxy& track) {
+    // collect the source link indices of the track states in track order
+    // together with their position
+    m_trackHits.clear();
+    for (const auto& trackState : track.trackStatesReversed()) {
+      if (!trackState.hasUncalibratedSourceLink()) {
+        continue;
+      }
+      const Acts::SourceLink& sourceLink =
+          trackState.getUncalibratedSourceLink();
+      m_trackHits.emplace_back(sourceLink.get<IndexSourceLink>().index(), 0);
+    }
+    std::reverse(m_trackHits.begin(), m_trackHits.end());
+    for (std::size_t i = 0; i < m_trackHits.size(); ++i) {
+      m_trackHits[i].second = i;
+    }
+
+    m_sortedTrackHits = m_trackHits;
+    std::sort(m_sortedTrackHits.begin(), m_sortedTrackHits.end());
+
+    for (const auto& [bottom, bottomPos] : m_trackHits) {
+      if (bottom + 1 >= m_offsets.size()) {
+        continue;
+      }
+      for (std::size_t i = m_offsets[bottom]; i < m_offsets[bottom + 1]; ++i) {
+        const Entry& entry = m_entries[i];
+        if (m_discovered[entry.seed]) {
+          continue;
+        }
+        // take the first middle measurement after the bottom one and the last
+        // top measurement to allow for repeated measurements on the track
+        auto middlePos = firstPositionAfter(entry.middle, bottomPos);
+        if (!middlePos.has_value()) {
+          continue;
+        }
+        auto topPos = lastPosition(entry.top);
+        if (topPos.has_value() && *topPos > *middlePos) {
+          m_discovered[entry.seed] = true;
+        }
       }
     }
   }
-}
+
+ private:
+  struct Entry {
+    Index middle = 0;
+    Index top = 0;
+    Index seed = 0;
+  };
+
+  /// Measurement index and position on the track
+  using TrackHit = std::pair<Index, std::size_t>;
+
+  std::optional<std::size_t> firstPositionAfter(Index measurement,
+                                                std::size_t position) const {
+    auto it = std::upper_bound(m_sortedTrackHits.begin(),
+                               m_sortedTrackHits.end(),
+                               TrackHit{measurement, position});
+    if (it == m_sortedTrackHits.end() || it->first != measurement) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+  std::optional<std::size_t> lastPosition(Index measurement) const {
+    auto it = std::upper_bound(
+        m_sortedTrackHits.begin(), m_sortedTrackHits.end(),
+        TrackHit{measurement, std::numeric_limits<std::size_t>::max()});
+    if (it == m_sortedTrackHits.begin() || std::prev(it)->first != measurement) {
+      return std::nullopt;
+    }
+    return std::prev(it)->second;
+  }
+
+  std::vector<std::size_t> m_offsets;
+  std::vector<Entry> m_entries;
+  std::vector<bool> m_discovered;
+
+  std::vector<TrackHit> m_trackHits;
+  std::vector<TrackHit> m_sortedTrackHits;
+};
 
 class BranchStopper {
  public:
@@ -340,7 +425,11 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   extensions.branchStopper.connect<&BranchStopper::operator()>(&branchStopper);
 
   IndexSourceLinkAccessor slAccessor;
-  slAccessor.container = &sourceLinks;
+  if (m_cfg.sourceLinkModuleIndex) {
+    slAccessor.setContainer(sourceLinks);
+  } else {
+    slAccessor.container = &sourceLinks;
+  }
   Acts::SourceLinkAccessorDelegate<IndexSourceLinkAccessor::Iterator>
       slAccessorDelegate;
   slAccessorDelegate.connect<&IndexSourceLinkAccessor::range>(&slAccessor);
@@ -404,19 +493,30 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
 
   unsigned int nSeed = 0;
 
-  // A map indicating whether a seed has been discovered already
-  std::unordered_map<SeedIdentifier, bool> discoveredSeeds;
+  // An index of the seeds indicating whether a seed has been discovered
+  // already
+  std::optional<SeedDeduplicationIndex> seedIndex;
+  if (seeds != nullptr && m_cfg.seedDeduplication) {
+    seedIndex.emplace(*seeds, measurements.size());
+  }
+
+  auto makeCandidate = [&](const TrackProxy& track,
+                           std::size_t nBranches) -> TrackProxy {
+    if (m_cfg.lightweightTrackCandidates && nBranches == 1) {
+      return track;
+    }
+    auto trackCopy = tracksTemp.makeTrack();
+    trackCopy.copyFrom(track, true);
+    return trackCopy;
+  };
 
   auto addTrack = [&](const TrackProxy& track) {
     ++m_nFoundTracks;
 
     // flag seeds which are covered by the track
-    visitSeedIdentifiers(track, [&](const SeedIdentifier& seedIdentifier) {
-      if (auto it = discoveredSeeds.find(seedIdentifier);
-          it != discoveredSeeds.end()) {
-        it->second = true;
-      }
-    });
+    if (seedIndex.has_value()) {
+      seedIndex->markCovered(track);
+    }
 
     if (m_trackSelector.has_value() && !m_trackSelector->isValidTrack(track)) {
       return;
@@ -429,29 +529,17 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
     destProxy.copyFrom(track, true);
   };
 
-  if (seeds != nullptr && m_cfg.seedDeduplication) {
-    // Index the seeds for deduplication
-    for (const auto& seed : *seeds) {
-      SeedIdentifier seedIdentifier = makeSeedIdentifier(seed);
-      discoveredSeeds.emplace(seedIdentifier, false);
-    }
-  }
-
   for (std::size_t iSeed = 0; iSeed < initialParameters.size(); ++iSeed) {
     m_nTotalSeeds++;
 
     if (seeds != nullptr) {
       const SimSeed& seed = seeds->at(iSeed);
 
-      if (m_cfg.seedDeduplication) {
-        SeedIdentifier seedIdentifier = makeSeedIdentifier(seed);
-        // check if the seed has been discovered already
-        if (auto it = discoveredSeeds.find(seedIdentifier);
-            it != discoveredSeeds.end() && it->second) {
-          m_nDeduplicatedSeeds++;
-          ACTS_VERBOSE("Skipping seed " << iSeed << " due to deduplication.");
-          continue;
-        }
+      // check if the seed has been discovered already
+      if (seedIndex.has_value() && seedIndex->isDiscovered(iSeed)) {
+        m_nDeduplicatedSeeds++;
+        ACTS_VERBOSE("Skipping seed " << iSeed << " due to deduplication.");
+        continue;
       }
 
       if (m_cfg.stayOnSeed) {
@@ -478,12 +566,11 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
 
     auto& firstTracksForSeed = firstResult.value();
     for (auto& firstTrack : firstTracksForSeed) {
-      // TODO a copy of the track should not be necessary but is the safest way
-      //      with the current EDM
-      // TODO a lightweight copy without copying all the track state components
-      //      might be a solution
-      auto trackCandidate = tracksTemp.makeTrack();
-      trackCandidate.copyFrom(firstTrack, true);
+      // A copy of the track is necessary if the branches share track states,
+      // since the smoothing and the two-way linking below modify the states
+      // in place. Otherwise the track can be used directly.
+      auto trackCandidate =
+          makeCandidate(firstTrack, firstTracksForSeed.size());
 
       auto firstSmoothingResult =
           Acts::smoothTrack(ctx.geoContext, trackCandidate, logger());
@@ -544,12 +631,9 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
                 continue;
               }
 
-              // TODO a copy of the track should not be necessary but is the
-              //      safest way with the current EDM
-              // TODO a lightweight copy without copying all the track state
-              //      components might be a solution
-              auto secondTrackCopy = tracksTemp.makeTrack();
-              secondTrackCopy.copyFrom(secondTrack, true);
+              // See above for when a copy of the track is necessary
+              auto secondTrackCopy =
+                  makeCandidate(secondTrack, secondTracksForSeed.size());
 
               // Note that this is only valid if there are no branches
               // We disallow this by breaking this look after a second track was
@@ -639,7 +723,7 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
 
   // Compute shared hits from all the reconstructed tracks
   if (m_cfg.computeSharedHits) {
-    computeSharedHits(sourceLinks, tracks);
+    computeSharedHits(tracks, sourceLinks.size());
   }
 
   ACTS_DEBUG("Finalized track finding with " << tracks.size()
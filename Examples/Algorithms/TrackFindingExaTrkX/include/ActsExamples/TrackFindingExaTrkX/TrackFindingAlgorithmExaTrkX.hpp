@@ -22,6 +22,8 @@
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/TrackFindingExaTrkX/TruthGraphBuilder.hpp"
 
+#include <condition_variable>
+#include <cstddef>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -82,6 +84,13 @@ class TrackFindingAlgorithmExaTrkX final : public IAlgorithm {
 
     /// Remove track candidates with 2 or less hits
     bool filterShortTracks = false;
+
+    /// Run the stages of different events concurrently. Each stage processes
+    /// one event at a time, so e.g. the graph of one event is constructed
+    /// while the edges of another event are classified.
+    bool pipelined = false;
+    /// Maximum number of events inside the stages in pipelined mode
+    std::size_t maxEventsInFlight = 4;
   };
 
   /// Constructor of the track finding algorithm
@@ -105,11 +114,24 @@ class TrackFindingAlgorithmExaTrkX final : public IAlgorithm {
   const Config& config() const { return m_cfg; }
 
  private:
+  /// Run the stages with one lock per stage in pipelined mode
+  std::vector<std::vector<int>> runPipelined(
+      std::vector<float>& features, std::vector<int>& spacepointIDs,
+      const Acts::ExaTrkXHook& hook) const;
+
   Config m_cfg;
 
   Acts::ExaTrkXPipeline m_pipeline;
   mutable std::mutex m_mutex;
 
+  /// Stage locks and number of events in flight for pipelined mode
+  mutable std::mutex m_graphConstructionMutex;
+  mutable std::vector<std::mutex> m_classifierMutexes;
+  mutable std::mutex m_trackBuildingMutex;
+  mutable std::mutex m_inFlightMutex;
+  mutable std::condition_variable m_inFlightCondition;
+  mutable std::size_t m_inFlight = 0;
+
   using Accumulator = boost::accumulators::accumulator_set<
       float, boost::accumulators::features<boost::accumulators::tag::mean,
                                            boost::accumulators::tag::variance>>;
@@ -118,6 +140,10 @@ class TrackFindingAlgorithmExaTrkX final : public IAlgorithm {
     Accumulator graphBuildingTime;
     std::vector<Accumulator> classifierTimes;
     Accumulator trackBuildingTime;
+    // time waiting for the stages in pipelined mode
+    Accumulator graphBuildingWaitTime;
+    std::vector<Accumulator> classifierWaitTimes;
+    Accumulator trackBuildingWaitTime;
   } m_timing;
 
   ReadDataHandle<SimSpacePointContainer> m_inputSpacePoints{this,
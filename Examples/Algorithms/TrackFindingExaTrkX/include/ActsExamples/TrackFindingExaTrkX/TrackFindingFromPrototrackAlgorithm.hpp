@@ -65,6 +65,18 @@ class TrackFindingFromPrototrackAlgorithm final : public IAlgorithm {
     /// Magnetic field
     std::shared_ptr<const Acts::MagneticFieldProvider> magneticField;
 
+    /// Compute shared hit information
+    bool computeSharedHits = false;
+
+    /// Run the track finding for the proto tracks of an event in parallel.
+    /// Every task fills its own track container, the containers are merged in
+    /// proto track order, so the output is identical to the serial mode.
+    bool parallel = false;
+
+    /// Look up the source links of a surface in a per-module table built once
+    /// per event and shared by all tasks, see `TrackFindingAlgorithm`
+    bool sourceLinkModuleIndex = false;
+
     /// Additional tag to distinguish loggers
     std::string tag = "";
   };
@@ -18,7 +18,9 @@
 #include "ActsExamples/EventData/SimSpacePoint.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <chrono>
 #include <numeric>
+#include <tuple>
 
 using namespace ActsExamples;
 using namespace Acts::UnitLiterals;
@@ -38,6 +40,35 @@ struct LoopHook : public Acts::ExaTrkXHook {
   }
 };
 
+/// Slot of an event in the pipeline, waits for a free slot on construction
+/// and releases it when leaving the scope
+class PipelineSlot {
+ public:
+  PipelineSlot(std::mutex& mutex, std::condition_variable& condition,
+               std::size_t& inFlight, std::size_t maxInFlight)
+      : m_mutex(mutex), m_condition(condition), m_inFlight(inFlight) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [&] { return m_inFlight < maxInFlight; });
+    ++m_inFlight;
+  }
+
+  PipelineSlot(const PipelineSlot&) = delete;
+  PipelineSlot& operator=(const PipelineSlot&) = delete;
+
+  ~PipelineSlot() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      --m_inFlight;
+    }
+    m_condition.notify_one();
+  }
+
+ private:
+  std::mutex& m_mutex;
+  std::condition_variable& m_condition;
+  std::size_t& m_inFlight;
+};
+
 // TODO do we have these function in the repo somewhere?
 float theta(float r, float z) {
   return std::atan2(r, z);
@@ -53,13 +84,17 @@ ActsExamples::TrackFindingAlgorithmExaTrkX::TrackFindingAlgorithmExaTrkX(
     : ActsExamples::IAlgorithm("TrackFindingMLBasedAlgorithm", level),
       m_cfg(std::move(config)),
       m_pipeline(m_cfg.graphConstructor, m_cfg.edgeClassifiers,
-                 m_cfg.trackBuilder, logger().clone()) {
+                 m_cfg.trackBuilder, logger().clone()),
+      m_classifierMutexes(m_cfg.edgeClassifiers.size()) {
   if (m_cfg.inputSpacePoints.empty()) {
     throw std::invalid_argument("Missing spacepoint input collection");
   }
   if (m_cfg.outputProtoTracks.empty()) {
     throw std::invalid_argument("Missing protoTrack output collection");
   }
+  if (m_cfg.pipelined && m_cfg.maxEventsInFlight == 0) {
+    throw std::invalid_argument("Need at least one event in flight");
+  }
 
   // Sanitizer run with dummy input to detect configuration issues
   // TODO This would be quite helpful I think, but currently it does not work
@@ -90,6 +125,9 @@ ActsExamples::TrackFindingAlgorithmExaTrkX::TrackFindingAlgorithmExaTrkX(
   m_timing.classifierTimes.resize(
       m_cfg.edgeClassifiers.size(),
       decltype(m_timing.classifierTimes)::value_type{0.f});
+  m_timing.classifierWaitTimes.resize(
+      m_cfg.edgeClassifiers.size(),
+      decltype(m_timing.classifierWaitTimes)::value_type{0.f});
 
   // Check if we want cluster features but do not have them
   const static std::array clFeatures = {
@@ -114,6 +152,79 @@ ActsExamples::TrackFindingAlgorithmExaTrkX::TrackFindingAlgorithmExaTrkX(
 
 /// Allow access to features with nice names
 
+std::vector<std::vector<int>>
+ActsExamples::TrackFindingAlgorithmExaTrkX::runPipelined(
+    std::vector<float>& features, std::vector<int>& spacepointIDs,
+    const Acts::ExaTrkXHook& hook) const {
+  using Clock = std::chrono::high_resolution_clock;
+  using Duration = std::chrono::duration<float, std::milli>;
+
+  // Limit the number of events holding intermediate graphs
+  PipelineSlot slot(m_inFlightMutex, m_inFlightCondition, m_inFlight,
+                    m_cfg.maxEventsInFlight);
+
+  // Run a stage once it is free and measure the time waiting for it and the
+  // time spent in it
+  auto runStage = [](std::mutex& mutex, Duration& waitTime,
+                     Duration& stageTime, auto&& stage) {
+    auto t0 = Clock::now();
+    std::lock_guard<std::mutex> lock(mutex);
+    auto t1 = Clock::now();
+    auto result = stage();
+    waitTime = t1 - t0;
+    stageTime = Clock::now() - t1;
+    return result;
+  };
+
+  const std::size_t nClassifiers = m_cfg.edgeClassifiers.size();
+  Duration graphBuildingWaitTime, graphBuildingTime;
+  std::vector<Duration> classifierWaitTimes(nClassifiers);
+  std::vector<Duration> classifierTimes(nClassifiers);
+  Duration trackBuildingWaitTime, trackBuildingTime;
+
+  std::any nodes, edges, edgeWeights;
+  std::tie(nodes, edges) =
+      runStage(m_graphConstructionMutex, graphBuildingWaitTime,
+               graphBuildingTime, [&] {
+                 return (*m_cfg.graphConstructor)(features,
+                                                  spacepointIDs.size());
+               });
+  hook(nodes, edges, {});
+
+  for (std::size_t i = 0; i < nClassifiers; ++i) {
+    std::tie(nodes, edges, edgeWeights) =
+        runStage(m_classifierMutexes[i], classifierWaitTimes[i],
+                 classifierTimes[i], [&] {
+                   return (*m_cfg.edgeClassifiers[i])(std::move(nodes),
+                                                      std::move(edges));
+                 });
+    hook(nodes, edges, edgeWeights);
+  }
+
+  auto trackCandidates =
+      runStage(m_trackBuildingMutex, trackBuildingWaitTime, trackBuildingTime,
+               [&] {
+                 return (*m_cfg.trackBuilder)(std::move(nodes),
+                                              std::move(edges),
+                                              std::move(edgeWeights),
+                                              spacepointIDs);
+               });
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_timing.graphBuildingTime(graphBuildingTime.count());
+    m_timing.graphBuildingWaitTime(graphBuildingWaitTime.count());
+    for (std::size_t i = 0; i < nClassifiers; ++i) {
+      m_timing.classifierTimes[i](classifierTimes[i].count());
+      m_timing.classifierWaitTimes[i](classifierWaitTimes[i].count());
+    }
+    m_timing.trackBuildingTime(trackBuildingTime.count());
+    m_timing.trackBuildingWaitTime(trackBuildingWaitTime.count());
+  }
+
+  return trackCandidates;
+}
+
 ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithmExaTrkX::execute(
     const ActsExamples::AlgorithmContext& ctx) const {
   // Setup hooks
@@ -209,6 +320,10 @@ ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithmExaTrkX::execute(
 
   // Run the pipeline
   const auto trackCandidates = [&]() {
+    if (m_cfg.pipelined) {
+      return runPipelined(features, spacepointIDs, hook);
+    }
+
     std::lock_guard<std::mutex> lock(m_mutex);
 
     Acts::ExaTrkXTiming timing;
@@ -283,5 +398,23 @@ ActsExamples::ProcessCode TrackFindingAlgorithmExaTrkX::finalize() {
                                    << std::sqrt(ba::variance(t)));
   }
 
+  if (m_cfg.pipelined) {
+    ACTS_INFO("Exa.TrkX time waiting for the stages");
+    {
+      const auto& t = m_timing.graphBuildingWaitTime;
+      ACTS_INFO("- graph building: " << ba::mean(t) << " +- "
+                                     << std::sqrt(ba::variance(t)));
+    }
+    for (const auto& t : m_timing.classifierWaitTimes) {
+      ACTS_INFO("- classifier:     " << ba::mean(t) << " +- "
+                                     << std::sqrt(ba::variance(t)));
+    }
+    {
+      const auto& t = m_timing.trackBuildingWaitTime;
+      ACTS_INFO("- track building: " << ba::mean(t) << " +- "
+                                     << std::sqrt(ba::variance(t)));
+    }
+  }
+
   return {};
 }
@@ -11,6 +11,16 @@
 #include "Acts/EventData/ProxyAccessor.hpp"
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/MeasurementCalibration.hpp"
+#include "ActsExamples/Utilities/SharedHits.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
 
 #include <boost/accumulators/accumulators.hpp>
 #include <boost/accumulators/statistics.hpp>
@@ -19,11 +29,7 @@ namespace {
 
 using namespace ActsExamples;
 
-struct ProtoTrackSourceLinkAccessor
-    : GeometryIdMultisetAccessor<IndexSourceLink> {
-  using BaseIterator = GeometryIdMultisetAccessor<IndexSourceLink>::Iterator;
-  using Iterator = Acts::SourceLinkAdapterIterator<BaseIterator>;
-
+struct ProtoTrackSourceLinkAccessor : IndexSourceLinkAccessor {
   std::unique_ptr<const Acts::Logger> loggerPtr;
   Container protoTrackSourceLinks;
 
@@ -40,8 +46,7 @@ struct ProtoTrackSourceLinkAccessor
       return {Iterator{begin}, Iterator{end}};
     }
 
-    assert(container != nullptr);
-    auto [begin, end] = container->equal_range(surface.geometryId());
+    auto [begin, end] = equalRange(surface.geometryId());
     ACTS_VERBOSE("Select " << std::distance(begin, end)
                            << " source-links from collection on "
                            << surface.geometryId());
@@ -95,71 +100,132 @@ ActsExamples::ProcessCode TrackFindingFromPrototrackAlgorithm::execute(
   extensions.measurementSelector.connect<&Acts::MeasurementSelector::select<
       typename TrackContainer::TrackStateContainerBackend>>(&measSel);
 
-  // The source link accessor
-  ProtoTrackSourceLinkAccessor sourceLinkAccessor;
-  sourceLinkAccessor.loggerPtr = logger().clone("SourceLinkAccessor");
-  sourceLinkAccessor.container = &sourceLinks;
-
-  Acts::SourceLinkAccessorDelegate<IndexSourceLinkAccessor::Iterator>
-      slAccessorDelegate;
-  slAccessorDelegate.connect<&ProtoTrackSourceLinkAccessor::range>(
-      &sourceLinkAccessor);
-
-  // Set the CombinatorialKalmanFilter options
-  TrackFindingAlgorithm::TrackFinderOptions options(
-      ctx.geoContext, ctx.magFieldContext, ctx.calibContext, slAccessorDelegate,
-      extensions, pOptions, &(*pSurface));
-
-  // Perform the track finding for all initial parameters
-  ACTS_DEBUG("Invoke track finding with " << initialParameters.size()
-                                          << " seeds.");
+  // The optional per-surface lookup table of the source links, built once and
+  // shared by the source link accessors of all tasks
+  std::shared_ptr<const IndexSourceLinkAccessor::ModuleIndex> moduleIndex;
+  if (m_cfg.sourceLinkModuleIndex) {
+    moduleIndex = std::make_shared<const IndexSourceLinkAccessor::ModuleIndex>(
+        sourceLinks);
+  }
 
-  auto trackContainer = std::make_shared<Acts::VectorTrackContainer>();
-  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
+  // Number of found tracks per proto track, empty if the track finding failed
+  std::vector<std::optional<std::size_t>> nTracksPerProtoTrack(
+      initialParameters.size());
+
+  // Run the track finding for the proto tracks in [begin, end) and add the
+  // found tracks to the given container. Returns false if a proto track
+  // contains an invalid hit index.
+  auto findTracksForProtoTracks = [&](std::size_t begin, std::size_t end,
+                                      TrackContainer& tracks) {
+    // The source link accessor
+    ProtoTrackSourceLinkAccessor sourceLinkAccessor;
+    sourceLinkAccessor.loggerPtr = logger().clone("SourceLinkAccessor");
+    sourceLinkAccessor.setContainer(sourceLinks, moduleIndex);
+
+    Acts::SourceLinkAccessorDelegate<IndexSourceLinkAccessor::Iterator>
+        slAccessorDelegate;
+    slAccessorDelegate.connect<&ProtoTrackSourceLinkAccessor::range>(
+        &sourceLinkAccessor);
+
+    // Set the CombinatorialKalmanFilter options
+    TrackFindingAlgorithm::TrackFinderOptions options(
+        ctx.geoContext, ctx.magFieldContext, ctx.calibContext,
+        slAccessorDelegate, extensions, pOptions, &(*pSurface));
+
+    Acts::ProxyAccessor<unsigned int> seedNumber("trackGroup");
+
+    for (std::size_t i = begin; i < end; ++i) {
+      sourceLinkAccessor.protoTrackSourceLinks.clear();
+
+      // Fill the source links via their indices from the container
+      for (const auto hitIndex : protoTracks.at(i)) {
+        if (auto it = sourceLinks.nth(hitIndex); it != sourceLinks.end()) {
+          sourceLinkAccessor.protoTrackSourceLinks.insert(*it);
+        } else {
+          ACTS_FATAL("Proto track " << i << " contains invalid hit index"
+                                    << hitIndex);
+          return false;
+        }
+      }
 
-  TrackContainer tracks(trackContainer, trackStateContainer);
+      auto result =
+          (*m_cfg.findTracks)(initialParameters.at(i), options, tracks);
 
-  tracks.addColumn<unsigned int>("trackGroup");
-  Acts::ProxyAccessor<unsigned int> seedNumber("trackGroup");
+      if (!result.ok()) {
+        ACTS_WARNING("Track finding failed for proto track "
+                     << i << " with error" << result.error());
+        continue;
+      }
 
-  std::size_t nSeed = 0;
-  std::size_t nFailed = 0;
+      auto& tracksForSeed = result.value();
 
-  std::vector<std::size_t> nTracksPerSeeds;
-  nTracksPerSeeds.reserve(initialParameters.size());
+      nTracksPerProtoTrack[i] = tracksForSeed.size();
 
-  for (auto i = 0ul; i < initialParameters.size(); ++i) {
-    sourceLinkAccessor.protoTrackSourceLinks.clear();
-
-    // Fill the source links via their indices from the container
-    for (const auto hitIndex : protoTracks.at(i)) {
-      if (auto it = sourceLinks.nth(hitIndex); it != sourceLinks.end()) {
-        sourceLinkAccessor.protoTrackSourceLinks.insert(*it);
-      } else {
-        ACTS_FATAL("Proto track " << i << " contains invalid hit index"
-                                  << hitIndex);
-        return ProcessCode::ABORT;
+      for (auto& track : tracksForSeed) {
+        // Set the seed number, which is the index of the proto track
+        seedNumber(track) = i;
       }
     }
+    return true;
+  };
 
-    auto result = (*m_cfg.findTracks)(initialParameters.at(i), options, tracks);
-    nSeed++;
+  auto makeTrackContainer = []() {
+    TrackContainer tracks(std::make_shared<Acts::VectorTrackContainer>(),
+                          std::make_shared<Acts::VectorMultiTrajectory>());
+    tracks.addColumn<unsigned int>("trackGroup");
+    return tracks;
+  };
 
-    if (!result.ok()) {
-      nFailed++;
-      ACTS_WARNING("Track finding failed for proto track " << i << " with error"
-                                                           << result.error());
-      continue;
+  // Perform the track finding for all initial parameters
+  ACTS_DEBUG("Invoke track finding with " << initialParameters.size()
+                                          << " seeds.");
+
+  TrackContainer tracks = makeTrackContainer();
+
+  if (m_cfg.parallel) {
+    // The track containers of the tasks keyed by their first proto track
+    std::map<std::size_t, TrackContainer> taskTracks;
+    std::mutex taskTracksMutex;
+    std::atomic<bool> invalidHitIndex{false};
+
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, initialParameters.size()),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          TrackContainer rangeTracks = makeTrackContainer();
+          if (!findTracksForProtoTracks(range.begin(), range.end(),
+                                        rangeTracks)) {
+            invalidHitIndex = true;
+            return;
+          }
+          std::lock_guard<std::mutex> guard(taskTracksMutex);
+          taskTracks.emplace(range.begin(), std::move(rangeTracks));
+        });
+
+    if (invalidHitIndex) {
+      return ProcessCode::ABORT;
     }
 
-    auto& tracksForSeed = result.value();
+    // Merge in proto track order, independent of the task scheduling
+    for (auto& [begin, rangeTracks] : taskTracks) {
+      for (auto track : rangeTracks) {
+        auto destProxy = tracks.makeTrack();
+        destProxy.copyFrom(track, true);
+      }
+    }
+  } else if (!findTracksForProtoTracks(0, initialParameters.size(), tracks)) {
+    return ProcessCode::ABORT;
+  }
 
-    nTracksPerSeeds.push_back(tracksForSeed.size());
+  std::size_t nSeed = initialParameters.size();
+  std::size_t nFailed = 0;
 
-    for (auto& track : tracksForSeed) {
-      // Set the seed number, this number decrease by 1 since the seed number
-      // has already been updated
-      seedNumber(track) = nSeed - 1;
+  std::vector<std::size_t> nTracksPerSeeds;
+  nTracksPerSeeds.reserve(initialParameters.size());
+  for (const auto& nTracks : nTracksPerProtoTrack) {
+    if (nTracks.has_value()) {
+      nTracksPerSeeds.push_back(*nTracks);
+    } else {
+      nFailed++;
     }
   }
 
@@ -170,13 +236,10 @@ ActsExamples::ProcessCode TrackFindingFromPrototrackAlgorithm::execute(
               std::back_inserter(m_nTracksPerSeeds));
   }
 
-  // TODO The computeSharedHits function is still a member function of
-  // TrackFindingAlgorithm, but could also be a free function. Uncomment this
-  // once this is done.
-  // Compute shared hits from all the reconstructed tracks if
-  // (m_cfg.computeSharedHits) {
-  //   computeSharedHits(sourceLinks, tracks);
-  // }
+  // Compute shared hits from all the reconstructed tracks
+  if (m_cfg.computeSharedHits) {
+    computeSharedHits(tracks, sourceLinks.size());
+  }
 
   ACTS_INFO("Event " << ctx.eventNumber << ": " << nFailed << " / " << nSeed
                      << " failed (" << ((100.f * nFailed) / nSeed) << "%)");
@@ -184,10 +247,10 @@ ActsExamples::ProcessCode TrackFindingFromPrototrackAlgorithm::execute(
                                              << " track candidates.");
   auto constTrackStateContainer =
       std::make_shared<Acts::ConstVectorMultiTrajectory>(
-          std::move(*trackStateContainer));
+          std::move(tracks.trackStateContainer()));
 
   auto constTrackContainer = std::make_shared<Acts::ConstVectorTrackContainer>(
-      std::move(*trackContainer));
+      std::move(tracks.container()));
 
   ConstTrackContainer constTracks{constTrackContainer,
                                   constTrackStateContainer};
@@ -9,9 +9,19 @@
 #pragma once
 
 #include "Acts/Utilities/DBScan.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <map>
+#include <mutex>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Acts {
@@ -23,7 +33,7 @@ namespace Acts {
 /// @param epsilon Maximum distance between 2 seed to be clustered
 /// @param minPoints Minimum number of seeds to create a cluster
 /// @return an unordered map representing the clusters, the keys the ID of the primary seed of each cluster and the stored value a vector of seed IDs.
-std::vector<std::vector<std::size_t>> dbscanSeedClustering(
+inline std::vector<std::vector<std::size_t>> dbscanSeedClustering(
     const std::vector<std::array<double, 4>>& input, float epsilon = 0.03,
     int minPoints = 2) {
   // Initialize a DBScan of dimension 4 (phi, eta, z, Pt)
@@ -45,4 +55,216 @@ std::vector<std::vector<std::size_t>> dbscanSeedClustering(
   return cluster;
 }
 
+/// Clusters seeds like `dbscanSeedClustering`, but finds the neighbours of a
+/// seed through a sparse grid with a cell size of epsilon instead of a
+/// KD-tree.
+///
+/// The seeds are sorted by their cell, so the seeds in the neighbouring cells
+/// in z and pT are contiguous and only the 9 neighbouring cells in (phi, eta)
+/// have to be looked up. The clusters are the same as with the KD-tree: the
+/// seeds are visited in the order of the input, a border seed which is
+/// reachable from several clusters is assigned to the first one, and each
+/// noise seed forms its own cluster after all other clusters. The
+/// neighbours of all seeds are searched once and kept for the cluster
+/// expansion, which needs memory proportional to the number of neighbours.
+///
+/// @param input Input parameters for the clustering (phi, eta, z, Pt)
+/// @param epsilon Maximum distance between 2 seed to be clustered
+/// @param minPoints Minimum number of seeds to create a cluster
+/// @return a vector of clusters, each of them a vector of seed IDs
+inline std::vector<std::vector<std::size_t>> dbscanSeedClusteringGrid(
+    const std::vector<std::array<double, 4>>& input, float epsilon = 0.03,
+    int minPoints = 2) {
+  using Cell = std::array<std::int64_t, 4>;
+  using Column = std::pair<std::int64_t, std::int64_t>;
+  struct ColumnHash {
+    std::size_t operator()(const Column& column) const {
+      // Unsigned arithmetic, the multiplications are allowed to wrap around
+      return static_cast<std::size_t>(
+          static_cast<std::uint64_t>(column.first) * 73856093u ^
+          static_cast<std::uint64_t>(column.second) * 19349663u);
+    }
+  };
+
+  const double eps = epsilon;
+  auto cellOf = [eps](const std::array<double, 4>& point) {
+    // Non-finite coordinates never have neighbours, the cell does not matter
+    constexpr double cellMax = 1e15;
+    Cell cell{};
+    for (std::size_t dim = 0; dim < 4; dim++) {
+      double index = std::floor(point[dim] / eps);
+      cell[dim] = std::isnan(index) ? 0
+                                    : static_cast<std::int64_t>(
+                                          std::clamp(index, -cellMax, cellMax));
+    }
+    return cell;
+  };
+
+  // Sort the seeds by cell and index the ranges of the (phi, eta) columns. The
+  // coordinates are stored with the cells to keep the neighbour search local
+  // in memory.
+  struct Entry {
+    Cell cell;
+    std::size_t iD;
+    std::array<double, 4> point;
+  };
+  std::vector<Entry> grid(input.size());
+  for (std::size_t iD = 0; iD < input.size(); iD++) {
+    grid[iD] = {cellOf(input[iD]), iD, input[iD]};
+  }
+  std::sort(grid.begin(), grid.end(), [](const Entry& a, const Entry& b) {
+    return std::tie(a.cell, a.iD) < std::tie(b.cell, b.iD);
+  });
+  std::unordered_map<Column, std::pair<std::size_t, std::size_t>, ColumnHash>
+      columnRanges;
+  for (std::size_t iG = 0; iG < grid.size(); iG++) {
+    const Cell& cell = grid[iG].cell;
+    auto it = columnRanges.try_emplace({cell[0], cell[1]}, iG, iG).first;
+    it->second.second = iG + 1;
+  }
+
+  // Call a function for all seeds within epsilon of a point, including the
+  // point itself. The boundary is inclusive, like for the KD-tree.
+  auto forEachNeighbour = [&](const std::array<double, 4>& point,
+                              auto&& callable) {
+    const Cell center = cellOf(point);
+    for (std::int64_t d0 = -1; d0 <= 1; d0++) {
+      for (std::int64_t d1 = -1; d1 <= 1; d1++) {
+        auto range = columnRanges.find({center[0] + d0, center[1] + d1});
+        if (range == columnRanges.end()) {
+          continue;
+        }
+        auto begin = grid.begin() + range->second.first;
+        auto end = grid.begin() + range->second.second;
+        begin = std::partition_point(begin, end, [&](const Entry& entry) {
+          return entry.cell[2] < center[2] - 1;
+        });
+        end = std::partition_point(begin, end, [&](const Entry& entry) {
+          return entry.cell[2] <= center[2] + 1;
+        });
+        for (auto it = begin; it != end; ++it) {
+          double distance2 = 0;
+          for (std::size_t dim = 0; dim < 4; dim++) {
+            double diff = it->point[dim] - point[dim];
+            distance2 += diff * diff;
+          }
+          if (distance2 <= eps * eps) {
+            callable(it->iD);
+          }
+        }
+      }
+    }
+  };
+
+  // Find the neighbours of all seeds once, in parallel. Going through the
+  // seeds in the order of the grid keeps the search local in memory. Each
+  // range of the grid stores the neighbours of its seeds back to back,
+  // sorted by seed ID.
+  struct RangeNeighbours {
+    std::vector<std::size_t> neighbours;
+    std::vector<std::size_t> counts;
+  };
+  std::map<std::size_t, RangeNeighbours> rangeNeighbours;
+  std::mutex rangeNeighboursMutex;
+  ActsExamples::tbbWrap::parallel_for(
+      tbb::blocked_range<std::size_t>(0, grid.size()),
+      [&](const tbb::blocked_range<std::size_t>& range) {
+        RangeNeighbours local;
+        local.counts.reserve(range.size());
+        for (std::size_t iG = range.begin(); iG != range.end(); ++iG) {
+          std::size_t first = local.neighbours.size();
+          forEachNeighbour(grid[iG].point, [&](std::size_t iN) {
+            local.neighbours.push_back(iN);
+          });
+          std::sort(local.neighbours.begin() + first, local.neighbours.end());
+          local.counts.push_back(local.neighbours.size() - first);
+        }
+        std::lock_guard lock(rangeNeighboursMutex);
+        rangeNeighbours.emplace(range.begin(), std::move(local));
+      });
+
+  // Merge the ranges, the neighbours of seed iD are stored in
+  // [neighbourRanges[iD].first, neighbourRanges[iD].second) of `neighbours`
+  std::vector<std::size_t> neighbours;
+  std::vector<std::pair<std::size_t, std::size_t>> neighbourRanges(
+      input.size());
+  {
+    std::size_t iG = 0;
+    for (auto& [begin, local] : rangeNeighbours) {
+      std::size_t first = neighbours.size();
+      for (auto count : local.counts) {
+        neighbourRanges[grid[iG++].iD] = {first, first + count};
+        first += count;
+      }
+      neighbours.insert(neighbours.end(), local.neighbours.begin(),
+                        local.neighbours.end());
+    }
+  }
+  rangeNeighbours.clear();
+
+  const auto minNeighbours = static_cast<std::size_t>(std::max(minPoints, 0));
+  auto isCore = [&](std::size_t iD) {
+    return neighbourRanges[iD].second - neighbourRanges[iD].first >=
+           minNeighbours;
+  };
+
+  // Cluster the seeds. Noise seeds stay unassigned until all clusters are
+  // built, since a later cluster can still claim them as border seeds.
+  std::vector<int> clusterAssignments(input.size(), -1);
+  std::vector<bool> visited(input.size(), false);
+  std::vector<std::size_t> toVisit;
+  // Push the neighbours of a core seed such that the ones with lower index
+  // are visited first
+  auto pushNeighbours = [&](std::size_t iD) {
+    const auto [first, last] = neighbourRanges[iD];
+    toVisit.insert(toVisit.end(),
+                   std::make_reverse_iterator(neighbours.begin() + last),
+                   std::make_reverse_iterator(neighbours.begin() + first));
+  };
+  int clusterNb = 0;
+  for (std::size_t iD = 0; iD < input.size(); iD++) {
+    if (visited[iD]) {
+      continue;
+    }
+    visited[iD] = true;
+    if (!isCore(iD)) {
+      continue;
+    }
+    // Expand the cluster
+    clusterAssignments[iD] = clusterNb;
+    pushNeighbours(iD);
+    while (!toVisit.empty()) {
+      std::size_t next = toVisit.back();
+      toVisit.pop_back();
+      if (clusterAssignments[next] == -1) {
+        clusterAssignments[next] = clusterNb;
+      }
+      if (visited[next]) {
+        continue;
+      }
+      visited[next] = true;
+      if (isCore(next)) {
+        pushNeighbours(next);
+      }
+    }
+    clusterNb++;
+  }
+
+  // Each remaining noise seed forms its own cluster
+  for (std::size_t iD = 0; iD < input.size(); iD++) {
+    if (clusterAssignments[iD] == -1) {
+      clusterAssignments[iD] = clusterNb++;
+    }
+  }
+
+  // Prepare the output
+  std::vector<std::vector<std::size_t>> cluster(clusterNb,
+                                                std::vector<std::size_t>());
+  for (std::size_t iD = 0; iD < input.size(); iD++) {
+    cluster[clusterAssignments[iD]].push_back(iD);
+  }
+
+  return cluster;
+}
+
 }  // namespace Acts
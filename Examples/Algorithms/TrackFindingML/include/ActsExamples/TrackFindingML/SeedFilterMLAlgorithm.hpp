@@ -51,6 +51,8 @@ class SeedFilterMLAlgorithm : public IAlgorithm {
     double clusteringWeighZ = 50.0;
     /// Clustering parameters weight for pT used before the DBSCAN
     double clusteringWeighPt = 1.0;
+    /// Find the neighbours in the DBSCAN with a grid instead of a KD-tree
+    bool gridDBScan = false;
   };
 
   /// Construct the seed filter algorithm.
@@ -10,6 +10,7 @@
 
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/Utilities/SharedHits.hpp"
 
 ActsExamples::AmbiguityResolutionML::AmbiguityResolutionML(
     std::string name, Acts::Logging::Level lvl)
@@ -20,26 +21,16 @@ ActsExamples::AmbiguityResolutionML::mapTrackHits(
     const ActsExamples::ConstTrackContainer& tracks,
     int nMeasurementsMin) const {
   std::multimap<int, std::pair<std::size_t, std::vector<std::size_t>>> trackMap;
+  // Collect the hits id of all the trajectories in parallel
+  const auto hitsPerTrack = measurementsPerTrack(tracks);
   // Loop over all the trajectories in the events
   for (const auto& track : tracks) {
-    std::vector<std::size_t> hits;
-    int nbMeasurements = 0;
-    // Store the hits id for the trajectory and compute the number of
-    // measurement
-    tracks.trackStateContainer().visitBackwards(
-        track.tipIndex(), [&](const auto& state) {
-          if (state.typeFlags().test(Acts::TrackStateFlag::MeasurementFlag)) {
-            std::size_t indexHit =
-                state.getUncalibratedSourceLink()
-                    .template get<ActsExamples::IndexSourceLink>()
-                    .index();
-            hits.emplace_back(indexHit);
-            ++nbMeasurements;
-          }
-        });
+    const auto& trackHits = hitsPerTrack[track.index()];
+    int nbMeasurements = static_cast<int>(trackHits.size());
     if (nbMeasurements < nMeasurementsMin) {
       continue;
     }
+    std::vector<std::size_t> hits(trackHits.begin(), trackHits.end());
     trackMap.emplace(nbMeasurements, std::make_pair(track.index(), hits));
   }
   return trackMap;
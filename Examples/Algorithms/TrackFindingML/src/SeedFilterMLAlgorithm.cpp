@@ -51,6 +51,7 @@ ActsExamples::ProcessCode ActsExamples::SeedFilterMLAlgorithm::execute(
   Eigen::Array<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
       networkInput(seeds.size(), 14);
   std::vector<std::array<double, 4>> clusteringParams;
+  clusteringParams.reserve(seeds.size());
   // Loop over the seed and parameters to fill the input for the clustering
   // and the NN
   for (std::size_t i = 0; i < seeds.size(); i++) {
@@ -75,8 +76,12 @@ ActsExamples::ProcessCode ActsExamples::SeedFilterMLAlgorithm::execute(
   }
 
   // Cluster the tracks using DBscan
-  auto cluster = Acts::dbscanSeedClustering(
-      clusteringParams, m_cfg.epsilonDBScan, m_cfg.minPointsDBScan);
+  auto cluster =
+      m_cfg.gridDBScan
+          ? Acts::dbscanSeedClusteringGrid(
+                clusteringParams, m_cfg.epsilonDBScan, m_cfg.minPointsDBScan)
+          : Acts::dbscanSeedClustering(clusteringParams, m_cfg.epsilonDBScan,
+                                       m_cfg.minPointsDBScan);
 
   // Select the ID of the track we want to keep
   std::vector<std::size_t> goodSeed = m_seedClassifier.solveAmbiguity(
@@ -95,8 +100,8 @@ ActsExamples::ProcessCode ActsExamples::SeedFilterMLAlgorithm::execute(
     outputTrackParameters.push_back(params[i]);
   }
 
-  m_outputSimSeeds(ctx, SimSeedContainer{outputSeeds});
-  m_outputTrackParameters(ctx, TrackParametersContainer{outputTrackParameters});
+  m_outputSimSeeds(ctx, std::move(outputSeeds));
+  m_outputTrackParameters(ctx, std::move(outputTrackParameters));
 
   return ActsExamples::ProcessCode::SUCCESS;
 }
@@ -15,6 +15,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/TrackFitting/TrackFitterFunction.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -33,6 +34,10 @@ class RefittingAlgorithm final : public IAlgorithm {
     std::shared_ptr<TrackFitterFunction> fit;
     /// Pick a single track for debugging (-1 process all tracks)
     int pickTrack = -1;
+    /// Refit the tracks of an event in parallel
+    bool parallel = false;
+    /// Number of consecutive tracks refitted by one task
+    std::size_t blockSize = 16;
   };
 
   /// Constructor of the fitting algorithm
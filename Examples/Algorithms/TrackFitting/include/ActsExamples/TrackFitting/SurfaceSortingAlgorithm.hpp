@@ -19,7 +19,6 @@
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
-#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -27,8 +26,6 @@
 namespace ActsExamples {
 struct AlgorithmContext;
 
-using TrackHitList = std::map<const double, const Index>;
-
 class SurfaceSortingAlgorithm final : public IAlgorithm {
  public:
   struct Config {
@@ -40,6 +37,9 @@ class SurfaceSortingAlgorithm final : public IAlgorithm {
     std::string inputMeasurementSimHitsMap;
     /// Output proto track collection
     std::string outputProtoTracks;
+    /// Sort the proto tracks in parallel. Each track is sorted into its own
+    /// slot, so the output is identical to the serial mode.
+    bool parallel = false;
   };
 
   SurfaceSortingAlgorithm(Config cfg, Acts::Logging::Level level);
@@ -19,6 +19,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/TrackFitting/TrackFitterFunction.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -52,6 +53,11 @@ class TrackFittingAlgorithm final : public IAlgorithm {
     int pickTrack = -1;
     // Type erased calibrator for the measurements
     std::shared_ptr<MeasurementCalibrator> calibrator;
+    /// Fit the proto tracks of an event in parallel. The fitter function and
+    /// the calibrator are shared between the tasks and must be thread-safe.
+    bool parallel = false;
+    /// Number of consecutive proto tracks fitted by one task
+    std::size_t blockSize = 16;
   };
 
   /// Constructor of the fitting algorithm
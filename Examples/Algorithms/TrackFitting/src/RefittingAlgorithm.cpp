@@ -23,7 +23,10 @@
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/TrackFitting/RefittingCalibrator.hpp"
 #include "ActsExamples/TrackFitting/TrackFitterFunction.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <optional>
 #include <ostream>
@@ -55,21 +58,22 @@ ActsExamples::ProcessCode ActsExamples::RefittingAlgorithm::execute(
   auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
   TrackContainer tracks(trackContainer, trackStateContainer);
 
-  // Perform the fit for each input track
-  std::vector<Acts::SourceLink> trackSourceLinks;
-  std::vector<const Acts::Surface*> surfSequence;
   RefittingCalibrator calibrator;
 
-  auto itrack = 0ul;
-  for (const auto& track : inputTracks) {
+  // Refit a single input track into the given track container
+  auto refitTrack = [&](std::size_t itrack, TrackContainer& target,
+                        std::vector<Acts::SourceLink>& trackSourceLinks,
+                        std::vector<const Acts::Surface*>& surfSequence) {
     // Check if you are not in picking mode
-    if (m_cfg.pickTrack > -1 && m_cfg.pickTrack != static_cast<int>(itrack++)) {
-      continue;
+    if (m_cfg.pickTrack > -1 && m_cfg.pickTrack != static_cast<int>(itrack)) {
+      return;
     }
 
+    const auto track = inputTracks.getTrack(itrack);
+
     if (!track.hasReferenceSurface()) {
       ACTS_VERBOSE("Skip track " << itrack << ": missing ref surface");
-      continue;
+      return;
     }
 
     TrackFitterFunction::GeneralFitterOptions options{
@@ -100,7 +104,7 @@ ActsExamples::ProcessCode ActsExamples::RefittingAlgorithm::execute(
 
     if (surfSequence.empty()) {
       ACTS_WARNING("Empty track " << itrack << " found.");
-      continue;
+      return;
     }
 
     ACTS_VERBOSE("Initial parameters: "
@@ -109,7 +113,7 @@ ActsExamples::ProcessCode ActsExamples::RefittingAlgorithm::execute(
 
     ACTS_DEBUG("Invoke direct fitter for track " << itrack);
     auto result = (*m_cfg.fit)(trackSourceLinks, initialParams, options,
-                               calibrator, surfSequence, tracks);
+                               calibrator, surfSequence, target);
 
     if (result.ok()) {
       // Get the fit output object
@@ -125,6 +129,53 @@ ActsExamples::ProcessCode ActsExamples::RefittingAlgorithm::execute(
                    << itrack << " with error: " << result.error() << ", "
                    << result.error().message());
     }
+  };
+
+  if (!m_cfg.parallel) {
+    // Perform the fit for each input track
+    std::vector<Acts::SourceLink> trackSourceLinks;
+    std::vector<const Acts::Surface*> surfSequence;
+    for (std::size_t itrack = 0; itrack < inputTracks.size(); ++itrack) {
+      refitTrack(itrack, tracks, trackSourceLinks, surfSequence);
+    }
+  } else {
+    // Refit blocks of tracks in parallel and merge them in input order, see
+    // `TrackFittingAlgorithm`
+    const std::size_t blockSize = std::max<std::size_t>(m_cfg.blockSize, 1);
+    const std::size_t nBlocks =
+        (inputTracks.size() + blockSize - 1) / blockSize;
+
+    std::vector<TrackContainer> blockTracks;
+    blockTracks.reserve(nBlocks);
+    for (std::size_t iblock = 0; iblock < nBlocks; ++iblock) {
+      blockTracks.emplace_back(std::make_shared<Acts::VectorTrackContainer>(),
+                               std::make_shared<Acts::VectorMultiTrajectory>());
+    }
+
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, nBlocks),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          std::vector<Acts::SourceLink> trackSourceLinks;
+          std::vector<const Acts::Surface*> surfSequence;
+          for (std::size_t iblock = range.begin(); iblock != range.end();
+               ++iblock) {
+            const std::size_t end =
+                std::min(inputTracks.size(), (iblock + 1) * blockSize);
+            for (std::size_t itrack = iblock * blockSize; itrack < end;
+                 ++itrack) {
+              refitTrack(itrack, blockTracks[iblock], trackSourceLinks,
+                         surfSequence);
+            }
+          }
+        });
+
+    for (const auto& block : blockTracks) {
+      tracks.ensureDynamicColumns(block);
+      for (const auto& track : block) {
+        auto destProxy = tracks.makeTrack();
+        destProxy.copyFrom(track, true);
+      }
+    }
   }
 
   std::stringstream ss;
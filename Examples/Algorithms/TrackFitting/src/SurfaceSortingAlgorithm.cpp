@@ -10,8 +10,10 @@
 
 #include "ActsExamples/EventData/ProtoTrack.hpp"
 #include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 #include "ActsFatras/EventData/Hit.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <stdexcept>
@@ -22,6 +24,34 @@ namespace ActsExamples {
 struct AlgorithmContext;
 }  // namespace ActsExamples
 
+namespace {
+
+/// Stable sort of the (time, hit) pairs by time
+///
+/// Proto tracks are short, so an insertion sort is used for them
+void sortByTime(std::vector<std::pair<double, ActsExamples::Index>>& hits) {
+  constexpr std::size_t maxInsertionSortSize = 32;
+
+  auto earlier = [](const auto& lhs, const auto& rhs) {
+    return lhs.first < rhs.first;
+  };
+
+  if (hits.size() > maxInsertionSortSize) {
+    std::stable_sort(hits.begin(), hits.end(), earlier);
+    return;
+  }
+  for (std::size_t i = 1; i < hits.size(); ++i) {
+    auto hit = hits[i];
+    std::size_t j = i;
+    for (; j > 0 && earlier(hit, hits[j - 1]); --j) {
+      hits[j] = hits[j - 1];
+    }
+    hits[j] = hit;
+  }
+}
+
+}  // namespace
+
 ActsExamples::SurfaceSortingAlgorithm::SurfaceSortingAlgorithm(
     Config cfg, Acts::Logging::Level level)
     : ActsExamples::IAlgorithm("SurfaceSortingAlgorithm", level),
@@ -51,34 +81,58 @@ ActsExamples::ProcessCode ActsExamples::SurfaceSortingAlgorithm::execute(
   const auto& simHits = m_inputSimHits(ctx);
   const auto& simHitsMap = m_inputMeasurementSimHitsMap(ctx);
 
+  // Proto tracks are sorted independently into their own slot, empty ones
+  // are dropped when collecting the output
+  std::vector<ProtoTrack> sortedProtoTracks(protoTracks.size());
+
+  // Sort the proto tracks [begin, end)
+  auto sortTracks = [&](std::size_t begin, std::size_t end) {
+    // (time, hit) buffer reused for all tracks of the range
+    std::vector<std::pair<double, Index>> trackHits;
+
+    for (std::size_t itrack = begin; itrack != end; ++itrack) {
+      const auto& protoTrack = protoTracks[itrack];
+      if (protoTrack.empty()) {
+        continue;
+      }
+
+      trackHits.clear();
+      for (const auto hit : protoTrack) {
+        const auto simHitIndex = simHitsMap.find(hit)->second;
+        auto simHit = simHits.nth(simHitIndex);
+        trackHits.emplace_back(simHit->time(), hit);
+      }
+
+      sortByTime(trackHits);
+
+      // Hits with the same truth time as a previous hit are dropped
+      auto& sortedProtoTrack = sortedProtoTracks[itrack];
+      sortedProtoTrack.reserve(trackHits.size());
+      for (std::size_t ihit = 0; ihit < trackHits.size(); ++ihit) {
+        if (ihit > 0 && trackHits[ihit].first == trackHits[ihit - 1].first) {
+          continue;
+        }
+        sortedProtoTrack.push_back(trackHits[ihit].second);
+      }
+    }
+  };
+
+  if (m_cfg.parallel) {
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, protoTracks.size()),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          sortTracks(range.begin(), range.end());
+        });
+  } else {
+    sortTracks(0, protoTracks.size());
+  }
+
   ProtoTrackContainer sortedTracks;
   sortedTracks.reserve(protoTracks.size());
-  TrackHitList trackHitList;
-
   for (std::size_t itrack = 0; itrack < protoTracks.size(); ++itrack) {
-    const auto& protoTrack = protoTracks[itrack];
-
-    ProtoTrack sortedProtoTrack;
-    sortedProtoTrack.reserve(protoTrack.size());
-    trackHitList.clear();
-
-    if (protoTrack.empty()) {
-      continue;
+    if (!protoTracks[itrack].empty()) {
+      sortedTracks.emplace_back(std::move(sortedProtoTracks[itrack]));
     }
-
-    for (const auto hit : protoTrack) {
-      const auto simHitIndex = simHitsMap.find(hit)->second;
-      auto simHit = simHits.nth(simHitIndex);
-      auto simHitTime = simHit->time();
-      trackHitList.insert(std::make_pair(simHitTime, hit));
-    }
-
-    /// Map will now be sorted by truth hit time
-    for (auto const& [time, hit] : trackHitList) {
-      sortedProtoTrack.emplace_back(hit);
-    }
-
-    sortedTracks.emplace_back(std::move(sortedProtoTrack));
   }
 
   m_outputProtoTracks(ctx, std::move(sortedTracks));
@@ -22,7 +22,10 @@
 #include "ActsExamples/EventData/ProtoTrack.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/TrackFitting/TrackFitterFunction.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <ostream>
@@ -102,12 +105,13 @@ ActsExamples::ProcessCode ActsExamples::TrackFittingAlgorithm::execute(
   auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
   TrackContainer tracks(trackContainer, trackStateContainer);
 
-  // Perform the fit for each input track
-  std::vector<Acts::SourceLink> trackSourceLinks;
-  for (std::size_t itrack = 0; itrack < protoTracks.size(); ++itrack) {
+  // Fit a single proto track into the given track container. Returns false if
+  // the proto track is invalid and the processing should be aborted.
+  auto fitTrack = [&](std::size_t itrack, TrackContainer& target,
+                      std::vector<Acts::SourceLink>& trackSourceLinks) {
     // Check if you are not in picking mode
     if (m_cfg.pickTrack > -1 && m_cfg.pickTrack != static_cast<int>(itrack)) {
-      continue;
+      return true;
     }
 
     // The list of hits and the initial start parameters
@@ -118,7 +122,7 @@ ActsExamples::ProcessCode ActsExamples::TrackFittingAlgorithm::execute(
     // of entries in input and output containers matches.
     if (protoTrack.empty()) {
       ACTS_WARNING("Empty track " << itrack << " found.");
-      continue;
+      return true;
     }
 
     ACTS_VERBOSE("Initial parameters: "
@@ -137,13 +141,13 @@ ActsExamples::ProcessCode ActsExamples::TrackFittingAlgorithm::execute(
       } else {
         ACTS_FATAL("Proto track " << itrack << " contains invalid hit index"
                                   << hitIndex);
-        return ProcessCode::ABORT;
+        return false;
       }
     }
 
     ACTS_DEBUG("Invoke direct fitter for track " << itrack);
     auto result = (*m_cfg.fit)(trackSourceLinks, initialParams, options,
-                               calibrator, tracks);
+                               calibrator, target);
 
     if (result.ok()) {
       // Get the fit output object
@@ -159,6 +163,62 @@ ActsExamples::ProcessCode ActsExamples::TrackFittingAlgorithm::execute(
                    << itrack << " with error: " << result.error() << ", "
                    << result.error().message());
     }
+    return true;
+  };
+
+  if (!m_cfg.parallel) {
+    // Perform the fit for each input track
+    std::vector<Acts::SourceLink> trackSourceLinks;
+    for (std::size_t itrack = 0; itrack < protoTracks.size(); ++itrack) {
+      if (!fitTrack(itrack, tracks, trackSourceLinks)) {
+        return ProcessCode::ABORT;
+      }
+    }
+  } else {
+    // Fit blocks of tracks in parallel, each into its own track container.
+    // The containers are merged in input order afterwards so the output does
+    // not depend on the number of threads.
+    const std::size_t blockSize = std::max<std::size_t>(m_cfg.blockSize, 1);
+    const std::size_t nBlocks =
+        (protoTracks.size() + blockSize - 1) / blockSize;
+
+    std::vector<TrackContainer> blockTracks;
+    blockTracks.reserve(nBlocks);
+    for (std::size_t iblock = 0; iblock < nBlocks; ++iblock) {
+      blockTracks.emplace_back(std::make_shared<Acts::VectorTrackContainer>(),
+                               std::make_shared<Acts::VectorMultiTrajectory>());
+    }
+
+    std::atomic<bool> aborted = false;
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, nBlocks),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          std::vector<Acts::SourceLink> trackSourceLinks;
+          for (std::size_t iblock = range.begin(); iblock != range.end();
+               ++iblock) {
+            const std::size_t end =
+                std::min(protoTracks.size(), (iblock + 1) * blockSize);
+            for (std::size_t itrack = iblock * blockSize; itrack < end;
+                 ++itrack) {
+              if (!fitTrack(itrack, blockTracks[iblock], trackSourceLinks)) {
+                aborted = true;
+                return;
+              }
+            }
+          }
+        });
+
+    if (aborted) {
+      return ProcessCode::ABORT;
+    }
+
+    for (const auto& block : blockTracks) {
+      tracks.ensureDynamicColumns(block);
+      for (const auto& track : block) {
+        auto destProxy = tracks.makeTrack();
+        destProxy.copyFrom(track, true);
+      }
+    }
   }
 
   std::stringstream ss;
@@ -65,6 +65,10 @@ class VertexFitterAlgorithm final : public IAlgorithm {
                       1e2 * Acts::UnitConstants::mm * Acts::UnitConstants::mm,
                       1e8 * Acts::UnitConstants::mm * Acts::UnitConstants::mm)
             .asDiagonal();
+    /// Fit the proto vertices of an event in parallel. Every task uses its
+    /// own magnetic field cache; the fitted vertices are identical to the
+    /// serial fit and keep the order of the proto vertices.
+    bool parallel = false;
   };
 
   VertexFitterAlgorithm(const Config& cfg, Acts::Logging::Level lvl);
@@ -18,7 +18,9 @@
 #include "ActsExamples/EventData/ProtoVertex.hpp"
 #include "ActsExamples/EventData/Vertex.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <optional>
 #include <ostream>
 #include <stdexcept>
 #include <system_error>
@@ -69,7 +71,18 @@ ActsExamples::ProcessCode ActsExamples::VertexFitterAlgorithm::execute(
   vertexFitterCfg.trackLinearizer.connect<&Linearizer::linearizeTrack>(
       &linearizer);
   VertexFitter vertexFitter(vertexFitterCfg);
-  auto fieldCache = m_cfg.bField->makeCache(ctx.magFieldContext);
+
+  // Vertex constraint, only used for the constrained fit
+  Acts::Vertex theConstraint;
+  theConstraint.setFullCovariance(m_cfg.constraintCov);
+  theConstraint.setFullPosition(m_cfg.constraintPos);
+
+  // Vertex fitter options
+  const VertexFitterOptions vfOptions =
+      m_cfg.doConstrainedFit
+          ? VertexFitterOptions(ctx.geoContext, ctx.magFieldContext,
+                                theConstraint)
+          : VertexFitterOptions(ctx.geoContext, ctx.magFieldContext);
 
   ACTS_VERBOSE("Read from '" << m_cfg.inputTrackParameters << "'");
   ACTS_VERBOSE("Read from '" << m_cfg.inputProtoVertices << "'");
@@ -79,21 +92,21 @@ ActsExamples::ProcessCode ActsExamples::VertexFitterAlgorithm::execute(
   const auto& protoVertices = m_inputProtoVertices(ctx);
   ACTS_VERBOSE("Have " << protoVertices.size() << " proto vertices");
 
-  std::vector<Acts::InputTrack> inputTracks;
-
-  VertexContainer fittedVertices;
-
-  for (const auto& protoVertex : protoVertices) {
+  // Fit a single proto vertex. The vertex fitter and the linearizer are
+  // stateless, the field cache is the only per-task state.
+  auto fitProtoVertex = [&](const ProtoVertex& protoVertex,
+                            Acts::MagneticFieldProvider::Cache& fieldCache)
+      -> std::optional<Acts::Vertex> {
     // un-constrained fit requires at least two tracks
     if ((!m_cfg.doConstrainedFit) && (protoVertex.size() < 2)) {
       ACTS_INFO(
           "Skip un-constrained vertex fit on proto-vertex with less than two "
           "tracks");
-      continue;
+      return std::nullopt;
     }
 
     // select input tracks for the input proto vertex
-    inputTracks.clear();
+    std::vector<Acts::InputTrack> inputTracks;
     inputTracks.reserve(protoVertex.size());
     for (const auto& trackIdx : protoVertex) {
       if (trackIdx >= inputTrackParameters.size()) {
@@ -104,44 +117,49 @@ ActsExamples::ProcessCode ActsExamples::VertexFitterAlgorithm::execute(
       inputTracks.emplace_back(&inputTrackParameters[trackIdx]);
     }
 
-    if (!m_cfg.doConstrainedFit) {
-      VertexFitterOptions vfOptions(ctx.geoContext, ctx.magFieldContext);
+    auto fitRes = vertexFitter.fit(inputTracks, vfOptions, fieldCache);
+    if (!fitRes.ok()) {
+      ACTS_ERROR("Error in " << (m_cfg.doConstrainedFit ? "constrained " : "")
+                             << "vertex fitter: " << fitRes.error().message());
+      return std::nullopt;
+    }
 
-      auto fitRes = vertexFitter.fit(inputTracks, vfOptions, fieldCache);
-      if (fitRes.ok()) {
-        fittedVertices.push_back(*fitRes);
-      } else {
-        ACTS_ERROR("Error in vertex fitter: " << fitRes.error().message());
-      }
-    } else {
-      // Vertex constraint
-      Acts::Vertex theConstraint;
-
-      theConstraint.setFullCovariance(m_cfg.constraintCov);
-      theConstraint.setFullPosition(m_cfg.constraintPos);
-
-      // Vertex fitter options
-      VertexFitterOptions vfOptionsConstr(ctx.geoContext, ctx.magFieldContext,
-                                          theConstraint);
-
-      auto fitRes = vertexFitter.fit(inputTracks, vfOptionsConstr, fieldCache);
-      if (fitRes.ok()) {
-        fittedVertices.push_back(*fitRes);
-      } else {
-        ACTS_ERROR(
-            "Error in constrained vertex fitter: " << fitRes.error().message());
-      }
+    ACTS_DEBUG("Fitted Vertex " << fitRes->fullPosition().transpose());
+    ACTS_DEBUG("Tracks at fitted Vertex: " << fitRes->tracks().size());
+    return std::move(*fitRes);
+  };
+
+  // The fit results in the order of the proto vertices
+  std::vector<std::optional<Acts::Vertex>> fitResults(protoVertices.size());
+
+  if (m_cfg.parallel) {
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, protoVertices.size()),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          auto fieldCache = m_cfg.bField->makeCache(ctx.magFieldContext);
+          for (std::size_t iVertex = range.begin(); iVertex != range.end();
+               ++iVertex) {
+            fitResults[iVertex] =
+                fitProtoVertex(protoVertices[iVertex], fieldCache);
+          }
+        });
+  } else {
+    auto fieldCache = m_cfg.bField->makeCache(ctx.magFieldContext);
+    for (std::size_t iVertex = 0; iVertex < protoVertices.size(); ++iVertex) {
+      fitResults[iVertex] = fitProtoVertex(protoVertices[iVertex], fieldCache);
     }
+  }
 
-    if (fittedVertices.empty()) {
-      ACTS_DEBUG("No fitted vertex");
-    } else {
-      ACTS_DEBUG("Fitted Vertex "
-                 << fittedVertices.back().fullPosition().transpose());
-      ACTS_DEBUG(
-          "Tracks at fitted Vertex: " << fittedVertices.back().tracks().size());
+  VertexContainer fittedVertices;
+  fittedVertices.reserve(protoVertices.size());
+  for (auto& fitResult : fitResults) {
+    if (fitResult.has_value()) {
+      fittedVertices.push_back(std::move(*fitResult));
     }
   }
+  if (fittedVertices.empty()) {
+    ACTS_DEBUG("No fitted vertex");
+  }
 
   m_outputVertices(ctx, std::move(fittedVertices));
   return ProcessCode::SUCCESS;
@@ -18,6 +18,7 @@
 #include <cassert>
 #include <cstddef>
 #include <iostream>
+#include <unordered_map>
 #include <utility>
 
 #include <boost/container/flat_map.hpp>
@@ -214,6 +215,53 @@ groupByModule(const GeometryIdMultiset<T>& container) {
   return makeGroupBy(container, detail::GeometryIdGetter());
 }
 
+/// Lookup table for the elements of each module / sensitive surface.
+///
+/// The table is built once from a container and maps each geometry id present
+/// in it to the contiguous range of its elements. Repeated lookups for the same
+/// surfaces are then a hash lookup instead of a binary search over the full
+/// container. The container must not be modified while the table is in use.
+///
+/// Building the table costs one hash insertion per module. The gain per lookup
+/// is largest for containers that fit in the cache; for very large containers
+/// both lookups are dominated by cache misses.
+template <typename T>
+class GeometryIdModuleIndex {
+ public:
+  using Container = GeometryIdMultiset<T>;
+  using Iterator = typename Container::const_iterator;
+
+  GeometryIdModuleIndex() = default;
+
+  /// Build the table for the given container.
+  explicit GeometryIdModuleIndex(const Container& container)
+      : m_container(&container) {
+    for (const auto& [geoId, elements] : groupByModule(container)) {
+      m_modules.emplace(geoId.value(),
+                        std::make_pair(elements.begin(), elements.end()));
+    }
+  }
+
+  /// The container the table was built for.
+  const Container* container() const { return m_container; }
+
+  /// Get the range of elements with the requested geometry id.
+  std::pair<Iterator, Iterator> equal_range(
+      Acts::GeometryIdentifier geoId) const {
+    assert(m_container != nullptr);
+    if (auto it = m_modules.find(geoId.value()); it != m_modules.end()) {
+      return it->second;
+    }
+    return {m_container->end(), m_container->end()};
+  }
+
+ private:
+  const Container* m_container = nullptr;
+  std::unordered_map<Acts::GeometryIdentifier::Value,
+                     std::pair<Iterator, Iterator>>
+      m_modules;
+};
+
 /// The accessor for the GeometryIdMultiset container
 ///
 /// It wraps up a few lookup methods to be used in the Combinatorial Kalman
@@ -16,6 +16,8 @@
 #include "ActsExamples/EventData/Index.hpp"
 
 #include <cassert>
+#include <memory>
+#include <utility>
 
 namespace ActsExamples {
 
@@ -102,10 +104,40 @@ struct IndexSourceLinkAccessor : GeometryIdMultisetAccessor<IndexSourceLink> {
 
   using Iterator = Acts::SourceLinkAdapterIterator<BaseIterator>;
 
+  using ModuleIndex = GeometryIdModuleIndex<IndexSourceLink>;
+
+  /// Per-surface lookup table, only used if it was built for the current
+  /// container. Otherwise the container is searched directly.
+  std::shared_ptr<const ModuleIndex> moduleIndex;
+
+  /// Set the container and build the per-surface lookup table for it
+  void setContainer(const Container& sourceLinks) {
+    setContainer(sourceLinks, std::make_shared<const ModuleIndex>(sourceLinks));
+  }
+
+  /// Set the container and use an already built lookup table for it
+  ///
+  /// The table can be shared between several accessors, e.g. one per task,
+  /// so it is only built once per event.
+  void setContainer(const Container& sourceLinks,
+                    std::shared_ptr<const ModuleIndex> sharedModuleIndex) {
+    container = &sourceLinks;
+    moduleIndex = std::move(sharedModuleIndex);
+  }
+
+  // get the range of elements with requested geoId as container iterators
+  std::pair<BaseIterator, BaseIterator> equalRange(
+      Acts::GeometryIdentifier geoId) const {
+    assert(container != nullptr);
+    if (moduleIndex != nullptr && moduleIndex->container() == container) {
+      return moduleIndex->equal_range(geoId);
+    }
+    return container->equal_range(geoId);
+  }
+
   // get the range of elements with requested geoId
   std::pair<Iterator, Iterator> range(const Acts::Surface& surface) const {
-    assert(container != nullptr);
-    auto [begin, end] = container->equal_range(surface.geometryId());
+    auto [begin, end] = equalRange(surface.geometryId());
     return {Iterator{begin}, Iterator{end}};
   }
 };
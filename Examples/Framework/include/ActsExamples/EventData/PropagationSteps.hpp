@@ -0,0 +1,98 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Propagator/detail/SteppingLogger.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Steps of all test propagations of an event in one flat buffer.
+///
+/// The steps of propagation `i` are stored in the range
+/// `[offsets[i], offsets[i + 1])` of a single step buffer, so an event needs
+/// two allocations instead of one per propagation.
+class PropagationStepContainer {
+ public:
+  using Step = Acts::detail::Step;
+
+  /// The steps of a single propagation
+  class StepRange {
+   public:
+    StepRange(const Step* begin, const Step* end)
+        : m_begin(begin), m_end(end) {}
+
+    const Step* begin() const { return m_begin; }
+    const Step* end() const { return m_end; }
+    std::size_t size() const { return m_end - m_begin; }
+    bool empty() const { return m_begin == m_end; }
+    const Step& operator[](std::size_t i) const { return m_begin[i]; }
+
+   private:
+    const Step* m_begin;
+    const Step* m_end;
+  };
+
+  /// Number of propagations
+  std::size_t size() const { return m_offsets.size() - 1; }
+
+  /// Whether the container holds no propagation
+  bool empty() const { return size() == 0; }
+
+  /// Number of steps of all propagations
+  std::size_t totalSteps() const { return m_steps.size(); }
+
+  /// Access the steps of a propagation
+  ///
+  /// @param i the index of the propagation
+  StepRange operator[](std::size_t i) const {
+    assert(i < size() && "Propagation index out of range");
+    return {m_steps.data() + m_offsets[i], m_steps.data() + m_offsets[i + 1]};
+  }
+
+  /// Reserve space for a number of propagations and steps
+  ///
+  /// @param nPropagations the number of propagations
+  /// @param nSteps the total number of steps
+  void reserve(std::size_t nPropagations, std::size_t nSteps) {
+    m_offsets.reserve(nPropagations + 1);
+    m_steps.reserve(nSteps);
+  }
+
+  /// Append the steps of one propagation
+  ///
+  /// @param steps the steps of the propagation
+  void push_back(const std::vector<Step>& steps) {
+    m_steps.insert(m_steps.end(), steps.begin(), steps.end());
+    m_offsets.push_back(m_steps.size());
+  }
+
+  /// Append several propagations whose steps are stored back to back
+  ///
+  /// @param steps the steps of all propagations
+  /// @param nStepsPerPropagation the number of steps of each propagation
+  void append(const std::vector<Step>& steps,
+              const std::vector<std::size_t>& nStepsPerPropagation) {
+    m_steps.insert(m_steps.end(), steps.begin(), steps.end());
+    for (auto nSteps : nStepsPerPropagation) {
+      m_offsets.push_back(m_offsets.back() + nSteps);
+    }
+    assert(m_offsets.back() == m_steps.size() &&
+           "Inconsistent number of steps");
+  }
+
+ private:
+  std::vector<Step> m_steps;
+  std::vector<std::size_t> m_offsets = {0};
+};
+
+}  // namespace ActsExamples
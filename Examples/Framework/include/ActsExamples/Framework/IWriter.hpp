@@ -34,6 +34,19 @@ class IWriter : public SequenceElement {
 
   /// Fulfil the algorithm interface
   ProcessCode initialize() override { return ProcessCode::SUCCESS; }
+
+  /// Make the data of all events written so far durable.
+  ///
+  /// Called by the sequencer at journal checkpoints, possibly concurrently
+  /// with `write`. Writers buffering data across events must override it.
+  virtual ProcessCode flush() { return ProcessCode::SUCCESS; }
+
+  /// Whether every event is written to its own output file.
+  ///
+  /// Only then the output of the events completed by a previous run survives
+  /// the construction of the writer. The sequencer refuses to resume from a
+  /// journal with writers returning false.
+  virtual bool writesPerEventOutput() const { return false; }
 };
 
 }  // namespace ActsExamples
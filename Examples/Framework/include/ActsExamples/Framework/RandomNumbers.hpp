@@ -55,6 +55,16 @@ class RandomNumbers {
   /// @param context is the AlgorithmContext of the host algorithm
   RandomEngine spawnGenerator(const AlgorithmContext& context) const;
 
+  /// Spawn a generator for an independent stream within the event, e.g. for
+  /// a detector module or a particle. The generator only depends on the event
+  /// and the stream identifier, so the generated numbers do not depend on the
+  /// order in which the streams are processed.
+  ///
+  /// @param context is the AlgorithmContext of the host algorithm
+  /// @param stream is the identifier of the stream within the event
+  RandomEngine spawnGenerator(const AlgorithmContext& context,
+                              std::uint64_t stream) const;
+
   /// Generate a event and algorithm specific seed value.
   ///
   /// This should only be used in special cases e.g. where a custom
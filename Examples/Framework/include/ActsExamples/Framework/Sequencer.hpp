@@ -20,6 +20,7 @@
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
@@ -90,6 +91,17 @@ class Sequencer {
     std::vector<FpeMask> fpeMasks{};
     bool failOnFirstFpe = false;
     std::size_t fpeStackTraceLength = 8;
+
+    /// Journal of the completed events, empty to disable journaling. Events
+    /// are listed once their output has been flushed by all writers. When
+    /// the sequencer is run again with the same configuration, the events
+    /// listed in the journal are skipped. Resuming is refused if a writer
+    /// collects all events in a single file, since the file is recreated
+    /// when the writer is constructed.
+    std::string journalFile;
+    /// Number of completed events between two journal checkpoints. Every
+    /// checkpoint flushes all writers and syncs the journal to disk.
+    std::size_t journalInterval = 100;
   };
 
   Sequencer(const Config &cfg);
@@ -167,6 +179,11 @@ class Sequencer {
   std::pair<std::string, std::size_t> fpeMaskCount(
       const boost::stacktrace::stacktrace &st, Acts::FpeType type) const;
 
+  /// Indices of the FPE masks matching the source location of a frame,
+  /// independent of the FPE type
+  const std::vector<std::size_t> &fpeMasksForFrame(
+      const boost::stacktrace::frame &frame) const;
+
   void fpeReport() const;
 
   struct SequenceElementWithFpeResult {
@@ -187,6 +204,13 @@ class Sequencer {
 
   std::atomic<std::size_t> m_nUnmaskedFpe = 0;
 
+  /// Formatted locations of the configured FPE masks
+  std::vector<std::string> m_fpeMaskLocations;
+  /// Matching FPE masks cached by frame address
+  mutable std::unordered_map<const void *, std::vector<std::size_t>>
+      m_fpeMaskCache;
+  mutable std::shared_mutex m_fpeMaskCacheMutex;
+
   const Acts::Logger &logger() const { return *m_logger; }
 };
 
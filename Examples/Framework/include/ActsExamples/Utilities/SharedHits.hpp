@@ -0,0 +1,176 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/EventData/TrackStateType.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Call a function for every measurement state of every track.
+///
+/// The tracks are processed in parallel; the callable is invoked with the
+/// index of the track, the track state and the index of its measurement. The
+/// states of a track are visited from the last to the first one.
+///
+/// @param tracks the tracks to process
+/// @param callable the function to call
+template <typename track_container_t, typename callable_t>
+void forEachMeasurementState(const track_container_t& tracks,
+                             const callable_t& callable) {
+  tbbWrap::parallel_for(
+      tbb::blocked_range<std::size_t>(0, tracks.size()),
+      [&](const tbb::blocked_range<std::size_t>& range) {
+        for (std::size_t i = range.begin(); i != range.end(); ++i) {
+          for (auto state : tracks.getTrack(i).trackStatesReversed()) {
+            if (!state.typeFlags().test(
+                    Acts::TrackStateFlag::MeasurementFlag)) {
+              continue;
+            }
+            Index hit = state.getUncalibratedSourceLink()
+                            .template get<IndexSourceLink>()
+                            .index();
+            callable(i, state, hit);
+          }
+        }
+      });
+}
+
+/// Collect the measurement indices of every track.
+///
+/// @param tracks the tracks to process
+///
+/// @return the measurement indices per track, from the last to the first
+///         track state
+template <typename track_container_t>
+std::vector<std::vector<Index>> measurementsPerTrack(
+    const track_container_t& tracks) {
+  std::vector<std::vector<Index>> result(tracks.size());
+  forEachMeasurementState(
+      tracks, [&](std::size_t iTrack, const auto& /*state*/, Index hit) {
+        result[iTrack].push_back(hit);
+      });
+  return result;
+}
+
+/// Bitset of the measurements which are used by more than one track.
+///
+/// The bitset is filled in parallel over the tracks. Each measurement owns
+/// one bit in an atomic `used` bitset and one bit in an atomic `shared`
+/// bitset, so the result does not depend on the order in which the tracks
+/// are processed. It works with mutable and const track containers and can
+/// be used by the track finding as well as the ambiguity resolution.
+class SharedHitBitset {
+ public:
+  /// Construct an empty bitset.
+  ///
+  /// @param nMeasurements the number of measurements in the event
+  explicit SharedHitBitset(std::size_t nMeasurements)
+      : m_nMeasurements(nMeasurements),
+        m_nWords((nMeasurements + kWordBits - 1) / kWordBits),
+        m_used(std::make_unique<std::atomic<Word>[]>(m_nWords)),
+        m_shared(std::make_unique<std::atomic<Word>[]>(m_nWords)) {
+    for (std::size_t i = 0; i < m_nWords; ++i) {
+      m_used[i].store(0, std::memory_order_relaxed);
+      m_shared[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  /// Mark the measurements of all tracks in the container.
+  ///
+  /// @param tracks the tracks to process
+  template <typename track_container_t>
+  void fill(const track_container_t& tracks) {
+    forEachMeasurementState(tracks, [&](std::size_t /*iTrack*/,
+                                        const auto& /*state*/, Index hit) {
+      checkIndex(hit);
+      const Word mask = Word{1} << (hit % kWordBits);
+      const Word used =
+          m_used[hit / kWordBits].fetch_or(mask, std::memory_order_relaxed);
+      if ((used & mask) != 0) {
+        m_shared[hit / kWordBits].fetch_or(mask, std::memory_order_relaxed);
+      }
+    });
+  }
+
+  /// Check if a measurement is used by more than one track.
+  ///
+  /// @param hit the measurement index
+  bool isShared(Index hit) const {
+    checkIndex(hit);
+    const Word mask = Word{1} << (hit % kWordBits);
+    return (m_shared[hit / kWordBits].load(std::memory_order_relaxed) &
+            mask) != 0;
+  }
+
+  /// Number of measurements covered by the bitset.
+  std::size_t size() const { return m_nMeasurements; }
+
+ private:
+  using Word = std::uint64_t;
+  static constexpr std::size_t kWordBits = 64;
+
+  void checkIndex(Index hit) const {
+    if (hit >= m_nMeasurements) {
+      throw std::out_of_range("Measurement index " + std::to_string(hit) +
+                              " is out of range for " +
+                              std::to_string(m_nMeasurements) +
+                              " measurements");
+    }
+  }
+
+  std::size_t m_nMeasurements;
+  std::size_t m_nWords;
+  std::unique_ptr<std::atomic<Word>[]> m_used;
+  std::unique_ptr<std::atomic<Word>[]> m_shared;
+};
+
+/// Flag all track states whose measurement is used by more than one track.
+///
+/// The flags are set in a second parallel pass over the track states rather
+/// than over the tracks, so each state is visited exactly once even if it is
+/// shared between several tracks, e.g. between the branches of the CKF.
+///
+/// @param tracks the tracks to decorate
+/// @param nMeasurements the number of measurements in the event
+inline void computeSharedHits(TrackContainer& tracks,
+                              std::size_t nMeasurements) {
+  SharedHitBitset sharedHits(nMeasurements);
+  sharedHits.fill(tracks);
+
+  auto& trackStates = tracks.trackStateContainer();
+  tbbWrap::parallel_for(
+      tbb::blocked_range<std::size_t>(0, trackStates.size()),
+      [&](const tbb::blocked_range<std::size_t>& range) {
+        for (std::size_t i = range.begin(); i != range.end(); ++i) {
+          auto state = trackStates.getTrackState(i);
+          if (!state.typeFlags().test(Acts::TrackStateFlag::MeasurementFlag)) {
+            continue;
+          }
+          Index hit =
+              state.getUncalibratedSourceLink().get<IndexSourceLink>().index();
+          if (sharedHits.isShared(hit)) {
+            state.typeFlags().set(Acts::TrackStateFlag::SharedHitFlag);
+          }
+        }
+      });
+}
+
+}  // namespace ActsExamples
@@ -64,7 +64,9 @@ namespace ActsExamples::tbbWrap {
 /// This means that enableTBB(nthreads) itself is not thread-safe. That should
 /// be fine because the task_arena is initialised before spawning any threads.
 /// If multi-threading is ever enabled, then it is not disabled.
-static bool enableTBB(int nthreads = -99) {
+/// The function is inline so that the setting is shared by all translation
+/// units, which allows algorithms to use the wrappers below as well.
+inline bool enableTBB(int nthreads = -99) {
   static bool setting = false;
   if (nthreads != -99) {
 #ifdef ACTS_EXAMPLES_NO_TBB
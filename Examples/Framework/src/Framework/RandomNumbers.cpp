@@ -25,6 +25,16 @@ ActsExamples::RandomEngine ActsExamples::RandomNumbers::spawnGenerator(
   return RandomEngine(generateSeed(context));
 }
 
+ActsExamples::RandomEngine ActsExamples::RandomNumbers::spawnGenerator(
+    const AlgorithmContext& context, std::uint64_t stream) const {
+  const std::uint64_t seed = generateSeed(context);
+  std::seed_seq seq{static_cast<std::uint32_t>(seed),
+                    static_cast<std::uint32_t>(seed >> 32),
+                    static_cast<std::uint32_t>(stream),
+                    static_cast<std::uint32_t>(stream >> 32)};
+  return RandomEngine(seq);
+}
+
 std::uint64_t ActsExamples::RandomNumbers::generateSeed(
     const AlgorithmContext& context) const {
   return m_cfg.seed + context.eventNumber;
@@ -31,16 +31,21 @@
 #include <exception>
 #include <fstream>
 #include <functional>
+#include <iomanip>
 #include <iterator>
 #include <limits>
+#include <mutex>
 #include <numeric>
 #include <ostream>
 #include <ratio>
 #include <regex>
+#include <shared_mutex>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <typeinfo>
+#include <unordered_map>
 
 #include <boost/stacktrace/stacktrace.hpp>
 
@@ -51,6 +56,8 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/core/demangle.hpp>
+#include <fcntl.h>
+#include <unistd.h>
 
 namespace ActsExamples {
 
@@ -101,6 +108,168 @@ std::string demangleAndShorten(std::string name) {
   return name;
 }
 
+/// Source location of a stack frame
+struct FpeSourceLocation {
+  std::string file;
+  unsigned int line = 0;
+  /// Function name and location as printed in stack traces
+  std::string description;
+};
+
+/// Resolve the source location of a stack frame.
+///
+/// Symbolisation is expensive, so the locations are cached by frame address
+/// for the whole process. This is shared by the mask matching and the
+/// printed stack traces.
+const FpeSourceLocation& fpeSourceLocation(
+    const boost::stacktrace::frame& frame) {
+  static std::shared_mutex mutex;
+  static std::unordered_map<const void*, FpeSourceLocation> cache;
+
+  {
+    std::shared_lock lock(mutex);
+    if (auto it = cache.find(frame.address()); it != cache.end()) {
+      return it->second;
+    }
+  }
+
+  std::string loc = Acts::FpeMonitor::getSourceLocation(frame);
+  auto it = loc.find_last_of(':');
+  FpeSourceLocation location{
+      loc.substr(0, it),
+      static_cast<unsigned int>(std::stoi(loc.substr(it + 1))),
+      frame.name() + " at " + loc};
+
+  // elements of the map are not invalidated by later insertions
+  std::unique_lock lock(mutex);
+  return cache.try_emplace(frame.address(), std::move(location)).first->second;
+}
+
+/// Format the first @p depth frames of a stack trace using the cached
+/// source locations.
+std::string fpeStackTraceToString(const boost::stacktrace::stacktrace& st,
+                                  std::size_t depth) {
+  std::stringstream ss;
+  std::size_t n = std::min(depth, st.size());
+  for (std::size_t i = 0; i < n; ++i) {
+    ss << std::setw(2) << i << "# "
+       << fpeSourceLocation(st[i]).description << "\n";
+  }
+  return ss.str();
+}
+
+/// Append-only journal of the completed events.
+///
+/// Completed events are collected until a checkpoint, where all writers are
+/// flushed before the events are appended to the journal and synced to disk.
+/// An event is therefore only listed once its output is durable.
+class EventJournal {
+ public:
+  EventJournal(std::string path, std::vector<IWriter*> writers,
+               std::size_t interval)
+      : m_path(std::move(path)),
+        m_writers(std::move(writers)),
+        m_interval(interval) {
+    m_fd = ::open(m_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (m_fd < 0) {
+      throw std::runtime_error("Could not open event journal '" + m_path +
+                               "'");
+    }
+    // drop a partially written last line from an interrupted run
+    if (::ftruncate(m_fd, validSize(m_path)) != 0) {
+      throw std::runtime_error("Could not repair event journal '" + m_path +
+                               "'");
+    }
+  }
+
+  EventJournal(const EventJournal&) = delete;
+  EventJournal& operator=(const EventJournal&) = delete;
+
+  ~EventJournal() { ::close(m_fd); }
+
+  /// Sorted event numbers listed in a journal, empty if it does not exist
+  static std::vector<std::size_t> read(const std::string& path) {
+    std::vector<std::size_t> events;
+    std::ifstream file(path);
+    std::string line;
+    std::size_t nRead = 0;
+    const std::size_t size = validSize(path);
+    while (nRead < size && std::getline(file, line)) {
+      nRead += line.size() + 1;
+      events.push_back(std::stoull(line));
+    }
+    std::sort(events.begin(), events.end());
+    events.erase(std::unique(events.begin(), events.end()), events.end());
+    return events;
+  }
+
+  /// Mark an event as completed and checkpoint if enough events are pending
+  void eventCompleted(std::size_t event) {
+    bool due = false;
+    {
+      std::lock_guard lock(m_pendingMutex);
+      m_pending.push_back(event);
+      due = m_pending.size() >= m_interval;
+    }
+    if (due) {
+      checkpoint(true);
+    }
+  }
+
+  /// Append all pending events to the journal
+  ///
+  /// @param flushWriters flush the writers first, not needed once the
+  ///        writers have been finalized
+  void checkpoint(bool flushWriters) {
+    std::lock_guard checkpointLock(m_checkpointMutex);
+    std::vector<std::size_t> events;
+    {
+      std::lock_guard lock(m_pendingMutex);
+      std::swap(events, m_pending);
+    }
+    if (events.empty()) {
+      return;
+    }
+    if (flushWriters) {
+      for (auto* writer : m_writers) {
+        if (writer->flush() != ProcessCode::SUCCESS) {
+          throw std::runtime_error("Failed to flush writer: " +
+                                   writer->name());
+        }
+      }
+    }
+    std::string lines;
+    for (auto event : events) {
+      lines += std::to_string(event) + "\n";
+    }
+    if (::write(m_fd, lines.data(), lines.size()) !=
+            static_cast<ssize_t>(lines.size()) ||
+        ::fsync(m_fd) != 0) {
+      throw std::runtime_error("Failed to write event journal '" + m_path +
+                               "'");
+    }
+  }
+
+ private:
+  /// Size of the journal up to and including the last complete line
+  static std::size_t validSize(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(file)),
+                        std::istreambuf_iterator<char>());
+    auto last = content.find_last_of('\n');
+    return last == std::string::npos ? 0 : last + 1;
+  }
+
+  std::string m_path;
+  std::vector<IWriter*> m_writers;
+  std::size_t m_interval;
+  int m_fd = -1;
+
+  std::mutex m_pendingMutex;
+  std::mutex m_checkpointMutex;
+  std::vector<std::size_t> m_pending;
+};
+
 }  // namespace
 
 Sequencer::Sequencer(const Sequencer::Config& cfg)
@@ -126,6 +295,18 @@ Sequencer::Sequencer(const Sequencer::Config& cfg)
         "ACTS_SEQUENCER_DISABLE_FPEMON");
     m_cfg.trackFpes = false;
   }
+
+  for (const auto& [file, lines, fType, count] : m_cfg.fpeMasks) {
+    const auto [start, end] = lines;
+    std::string ls = start + 1 == end ? std::to_string(start)
+                                      : "(" + std::to_string(start) + ", " +
+                                            std::to_string(end) + "]";
+    m_fpeMaskLocations.push_back(file + ":" + ls);
+  }
+
+  if (m_cfg.journalInterval == 0) {
+    throw std::invalid_argument("Journal interval must be positive");
+  }
 }
 
 void Sequencer::addContextDecorator(
@@ -386,6 +567,9 @@ inline std::string asString(D duration) {
 // Convert duration scaled to one event to a printable string.
 template <typename D>
 inline std::string perEvent(D duration, std::size_t numEvents) {
+  if (numEvents == 0) {
+    return asString(D::zero()) + "/event";
+  }
   return asString(duration / numEvents) + "/event";
 }
 
@@ -400,7 +584,7 @@ void storeTiming(const std::vector<std::string>& identifiers,
     const auto time_total_s =
         std::chrono::duration_cast<Seconds>(durations[i]).count();
     file << identifiers[i] << "," << time_total_s << ","
-         << time_total_s / numEvents << "\n";
+         << (numEvents > 0 ? time_total_s / numEvents : 0.) << "\n";
   }
   file << "\n";
 }
@@ -424,6 +608,42 @@ int Sequencer::run() {
 
   ACTS_INFO("Processing events [" << eventsRange.first << ", "
                                   << eventsRange.second << ")");
+
+  // events completed by a previous run with the same journal
+  std::vector<std::size_t> journaledEvents;
+  if (!m_cfg.journalFile.empty()) {
+    journaledEvents = EventJournal::read(m_cfg.journalFile);
+  }
+  const std::size_t nJournaledEvents = std::distance(
+      std::lower_bound(journaledEvents.begin(), journaledEvents.end(),
+                       eventsRange.first),
+      std::lower_bound(journaledEvents.begin(), journaledEvents.end(),
+                       eventsRange.second));
+  if (nJournaledEvents > 0) {
+    // A writer collecting all events in one file has recreated it when it was
+    // constructed, the output of the journaled events is lost
+    std::vector<std::string> singleFileWriters;
+    for (const auto& [alg, fpe] : m_sequenceElements) {
+      if (const auto* writer = dynamic_cast<const IWriter*>(alg.get());
+          writer != nullptr && !writer->writesPerEventOutput()) {
+        singleFileWriters.push_back(writer->name());
+      }
+    }
+    if (!singleFileWriters.empty()) {
+      ACTS_FATAL("Cannot resume from the journal '"
+                 << m_cfg.journalFile << "' with " << nJournaledEvents
+                 << " completed events, the output of the writers ["
+                 << boost::algorithm::join(singleFileWriters, ", ")
+                 << "] does not contain them. Remove the journal to process "
+                    "all events again.");
+      throw std::runtime_error("Cannot resume from the event journal");
+    }
+    ACTS_INFO("Skipping " << nJournaledEvents
+                          << " events already completed according to the "
+                             "journal '"
+                          << m_cfg.journalFile << "'");
+  }
+
   ACTS_INFO("Starting event loop with " << m_cfg.numThreads << " threads");
   ACTS_INFO("  " << m_decorators.size() << " context decorators");
   ACTS_INFO("  " << m_sequenceElements.size() << " sequence elements");
@@ -458,9 +678,22 @@ int Sequencer::run() {
     }
   }
 
+  std::optional<EventJournal> journal;
+  if (!m_cfg.journalFile.empty()) {
+    std::vector<IWriter*> writers;
+    for (auto& [alg, fpe] : m_sequenceElements) {
+      if (auto* writer = dynamic_cast<IWriter*>(alg.get()); writer != nullptr) {
+        writers.push_back(writer);
+      }
+    }
+    journal.emplace(m_cfg.journalFile, std::move(writers),
+                    m_cfg.journalInterval);
+  }
+
   // execute the parallel event loop
   std::atomic<std::size_t> nProcessedEvents = 0;
-  std::size_t nTotalEvents = eventsRange.second - eventsRange.first;
+  std::size_t nTotalEvents =
+      eventsRange.second - eventsRange.first - nJournaledEvents;
   m_taskArena.execute([&] {
     tbbWrap::parallel_for(
         tbb::blocked_range<std::size_t>(eventsRange.first, eventsRange.second),
@@ -469,6 +702,10 @@ int Sequencer::run() {
                                                       Duration::zero());
 
           for (std::size_t event = r.begin(); event != r.end(); ++event) {
+            if (std::binary_search(journaledEvents.begin(),
+                                   journaledEvents.end(), event)) {
+              continue;
+            }
             ACTS_DEBUG("start processing event " << event);
             m_cfg.iterationCallback();
             // Use per-event store
@@ -519,8 +756,7 @@ int Sequencer::run() {
                        << " exceeded configured per-event threshold of "
                        << nMasked << " (mask: " << maskLoc
                        << ") (seen: " << count << " FPEs)\n"
-                       << Acts::FpeMonitor::stackTraceToString(
-                              *st, m_cfg.fpeStackTraceLength);
+                       << fpeStackTraceToString(*st, m_cfg.fpeStackTraceLength);
 
                     m_nUnmaskedFpe += (count - nMasked);
 
@@ -540,6 +776,10 @@ int Sequencer::run() {
               context.fpeMonitor = nullptr;
             }
 
+            if (journal) {
+              journal->eventCompleted(event);
+            }
+
             nProcessedEvents++;
             if (logger().level() <= Acts::Logging::DEBUG) {
               ACTS_DEBUG("finished event " << event);
@@ -571,13 +811,18 @@ int Sequencer::run() {
     }
   }
 
+  // the output of the remaining events is complete after finalization
+  if (journal) {
+    journal->checkpoint(false);
+  }
+
   fpeReport();
 
   // summarize timing
   Duration totalWall = Clock::now() - clockWallStart;
   Duration totalReal = std::accumulate(
       clocksAlgorithms.begin(), clocksAlgorithms.end(), Duration::zero());
-  std::size_t numEvents = eventsRange.second - eventsRange.first;
+  std::size_t numEvents = nTotalEvents;
   ACTS_INFO("Processed " << numEvents << " events in " << asString(totalWall)
                          << " (wall clock)");
   ACTS_INFO("Average time per event: " << perEvent(totalReal, numEvents));
@@ -637,8 +882,7 @@ void Sequencer::fpeReport() const {
                                            " per event by " + maskLoc + "]"
                                      : "")
                      << "\n"
-                     << Acts::FpeMonitor::stackTraceToString(
-                            *st, m_cfg.fpeStackTraceLength));
+                     << fpeStackTraceToString(*st, m_cfg.fpeStackTraceLength));
     }
   }
 
@@ -652,24 +896,43 @@ void Sequencer::fpeReport() const {
 std::pair<std::string, std::size_t> Sequencer::fpeMaskCount(
     const boost::stacktrace::stacktrace& st, Acts::FpeType type) const {
   for (const auto& frame : st) {
-    std::string loc = Acts::FpeMonitor::getSourceLocation(frame);
-    auto it = loc.find_last_of(':');
-    std::string locFile = loc.substr(0, it);
-    unsigned int locLine = std::stoi(loc.substr(it + 1));
-    for (const auto& [file, lines, fType, count] : m_cfg.fpeMasks) {
-      const auto [start, end] = lines;
-      if (boost::algorithm::ends_with(locFile, file) &&
-          (start <= locLine && locLine < end) && fType == type) {
-        std::string ls = start + 1 == end ? std::to_string(start)
-                                          : "(" + std::to_string(start) + ", " +
-                                                std::to_string(end) + "]";
-        return {file + ":" + ls, count};
+    for (auto imask : fpeMasksForFrame(frame)) {
+      const auto& mask = m_cfg.fpeMasks[imask];
+      if (mask.type == type) {
+        return {m_fpeMaskLocations[imask], mask.count};
       }
     }
   }
   return {"NONE", 0};
 }
 
+const std::vector<std::size_t>& Sequencer::fpeMasksForFrame(
+    const boost::stacktrace::frame& frame) const {
+  {
+    std::shared_lock lock(m_fpeMaskCacheMutex);
+    if (auto it = m_fpeMaskCache.find(frame.address());
+        it != m_fpeMaskCache.end()) {
+      return it->second;
+    }
+  }
+
+  const auto& location = fpeSourceLocation(frame);
+  std::vector<std::size_t> masks;
+  for (std::size_t imask = 0; imask < m_cfg.fpeMasks.size(); ++imask) {
+    const auto& [file, lines, fType, count] = m_cfg.fpeMasks[imask];
+    const auto [start, end] = lines;
+    if (boost::algorithm::ends_with(location.file, file) &&
+        (start <= location.line && location.line < end)) {
+      masks.push_back(imask);
+    }
+  }
+
+  // elements of the map are not invalidated by later insertions
+  std::unique_lock lock(m_fpeMaskCacheMutex);
+  return m_fpeMaskCache.try_emplace(frame.address(), std::move(masks))
+      .first->second;
+}
+
 Acts::FpeMonitor::Result Sequencer::fpeResult() const {
   Acts::FpeMonitor::Result merged;
   for (auto& [alg, fpe] : m_sequenceElements) {
@@ -41,6 +41,9 @@ class CsvExaTrkXGraphWriter final : public WriterT<Graph> {
   /// Readonly access to the config
   const Config& config() const { return m_cfg; }
 
+  /// Journal resume hook
+  bool writesPerEventOutput() const override { return true; }
+
  protected:
   /// Type-specific write implementation.
   ///
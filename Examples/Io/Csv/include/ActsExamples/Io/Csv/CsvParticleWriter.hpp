@@ -57,6 +57,9 @@ class CsvParticleWriter final : public WriterT<SimParticleContainer> {
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
+  /// Journal resume hook
+  bool writesPerEventOutput() const override { return true; }
+
  protected:
   /// Type-specific write implementation.
   ///
@@ -52,6 +52,9 @@ class CsvProtoTrackWriter final : public WriterT<ProtoTrackContainer> {
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
+  /// Journal resume hook
+  bool writesPerEventOutput() const override { return true; }
+
  protected:
   /// This implementation holds the actual writing method
   /// and is called by the WriterT<>::write interface
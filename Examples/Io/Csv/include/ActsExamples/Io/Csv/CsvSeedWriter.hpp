@@ -63,6 +63,9 @@ class CsvSeedWriter : public WriterT<TrackParametersContainer> {
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
+  /// Journal resume hook
+  bool writesPerEventOutput() const override { return true; }
+
  protected:
   /// @brief Write method called by the base class
   /// @param [in] ctx is the algorithm context for event information
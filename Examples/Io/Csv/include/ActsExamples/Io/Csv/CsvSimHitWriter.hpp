@@ -56,6 +56,9 @@ class CsvSimHitWriter final : public WriterT<SimHitContainer> {
   /// Readonly access to the config
   const Config& config() const { return m_cfg; }
 
+  /// Journal resume hook
+  bool writesPerEventOutput() const override { return true; }
+
  protected:
   /// Type-specific write implementation.
   ///
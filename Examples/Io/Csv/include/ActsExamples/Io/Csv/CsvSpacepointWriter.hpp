@@ -59,6 +59,9 @@ class CsvSpacepointWriter final : public WriterT<SimSpacePointContainer> {
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
+  /// Journal resume hook
+  bool writesPerEventOutput() const override { return true; }
+
  protected:
   /// This implementation holds the actual writing method
   /// and is called by the WriterT<>::write interface
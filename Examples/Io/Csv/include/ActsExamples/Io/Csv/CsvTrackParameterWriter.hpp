@@ -69,6 +69,9 @@ class CsvTrackParameterWriter final : public IWriter {
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
+  /// Journal resume hook
+  bool writesPerEventOutput() const override { return true; }
+
  private:
   Config m_cfg;
   std::unique_ptr<const Acts::Logger> m_logger;
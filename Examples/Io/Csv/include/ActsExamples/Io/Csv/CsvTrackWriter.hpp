@@ -67,6 +67,9 @@ class CsvTrackWriter : public WriterT<ConstTrackContainer> {
   /// Readonly access to the config
   const Config& config() const { return m_cfg; }
 
+  /// Journal resume hook
+  bool writesPerEventOutput() const override { return true; }
+
  protected:
   /// @brief Write method called by the base class
   /// @param [in] context is the algorithm context for consistency
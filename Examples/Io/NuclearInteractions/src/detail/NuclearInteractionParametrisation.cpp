@@ -9,15 +9,20 @@
 #include "ActsExamples/Io/NuclearInteractions/detail/NuclearInteractionParametrisation.hpp"
 
 #include "Acts/Definitions/Common.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 #include "ActsFatras/EventData/Particle.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <complex>
+#include <cstddef>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <Eigen/Eigenvalues>
+#include <TAxis.h>
 #include <TMath.h>
 #include <TVectorF.h>
 #include <TVectorT.h>
@@ -25,25 +30,59 @@
 namespace ActsExamples::detail::NuclearInteractionParametrisation {
 namespace {
 
+/// Normalised cumulative distribution of a histogram.
+///
+/// The distribution is built once per histogram and evaluated without
+/// touching ROOT, so it can be used concurrently. The values reproduce the
+/// ones of `DrawNormalized()` followed by `GetCumulative()`, including a
+/// vanishing probability for values in the under- and overflow bins.
+class CumulativeDistributionLookup {
+ public:
+  explicit CumulativeDistributionLookup(TH1F const* histo) {
+    const TAxis* axis = histo->GetXaxis();
+    const int nBins = histo->GetNbinsX();
+    m_borders.reserve(nBins + 1);
+    m_cumulative.reserve(nBins);
+
+    // Normalisation as in TH1::DrawNormalized()
+    const double scale = 1. / histo->GetSumOfWeights();
+    double sum = 0.;
+    for (int iBin = 1; iBin <= nBins; iBin++) {
+      m_borders.push_back(axis->GetBinLowEdge(iBin));
+      sum += static_cast<float>(histo->GetBinContent(iBin) * scale);
+      m_cumulative.push_back(static_cast<float>(sum));
+    }
+    m_borders.push_back(axis->GetBinUpEdge(nBins));
+  }
+
+  /// Cumulative probability at a value
+  float operator()(float value) const {
+    // Index of the first border above the value, i.e. the ROOT bin number
+    auto it = std::upper_bound(m_borders.begin(), m_borders.end(), value);
+    const auto bin =
+        static_cast<std::size_t>(std::distance(m_borders.begin(), it));
+    if (bin == 0 || bin == m_borders.size()) {
+      return 0.;
+    }
+    return m_cumulative[bin - 1];
+  }
+
+ private:
+  std::vector<double> m_borders;
+  std::vector<float> m_cumulative;
+};
+
 /// @brief Evaluate the location in a standard normal distribution for a value
 /// from a probability distribution
 ///
-/// @param [in] histo The probability distribution
-/// @param [in] mom The abscissa value in @p histo
+/// @param [in] cumulative The cumulative probability distribution
+/// @param [in] mom The abscissa value in @p cumulative
 ///
 /// @return The location in a standard normal distribution
-float gaussianValue(TH1F const* histo, const float mom) {
-  // Get the cumulative probability distribution
-  TH1F* normalised = static_cast<TH1F*>(histo->DrawNormalized());
-  TH1F* cumulative = static_cast<TH1F*>(normalised->GetCumulative());
-  // Find the cumulative probability
-  const float binContent = cumulative->GetBinContent(cumulative->FindBin(mom));
+float gaussianValue(const CumulativeDistributionLookup& cumulative,
+                    const float mom) {
   // Transform the probability to an entry in a standard normal distribution
-  const float value = TMath::ErfInverse(2. * binContent - 1.);
-
-  delete (normalised);
-  delete (cumulative);
-  return value;
+  return TMath::ErfInverse(2. * cumulative(mom) - 1.);
 }
 
 /// @brief Evaluate the invariant mass of two four vectors
@@ -73,15 +112,25 @@ std::pair<Vector, Matrix> calculateMeanAndCovariance(
   }
   mean /= events.size();
 
-  // Calculate the covariance matrix
+  // Calculate the covariance matrix in a single pass over the events. Only
+  // the lower triangle is accumulated and mirrored afterwards.
   Matrix covariance = Matrix::Zero(multiplicity, multiplicity);
-  for (unsigned int i = 0; i < multiplicity; i++) {
+  Vector residual(multiplicity);
+  for (const std::vector<float>& event : events) {
+    for (unsigned int i = 0; i < multiplicity; i++) {
+      residual[i] = event[i] - mean[i];
+    }
     for (unsigned int j = 0; j < multiplicity; j++) {
-      for (unsigned int k = 0; k < events.size(); k++) {
-        covariance(i, j) += (events[k][i] - mean[i]) * (events[k][j] - mean[j]);
+      for (unsigned int i = j; i < multiplicity; i++) {
+        covariance(i, j) += residual[i] * residual[j];
       }
     }
   }
+  for (unsigned int j = 0; j < multiplicity; j++) {
+    for (unsigned int i = j + 1; i < multiplicity; i++) {
+      covariance(j, i) = covariance(i, j);
+    }
+  }
   covariance /= events.size();
 
   return std::make_pair(mean, covariance);
@@ -196,17 +245,27 @@ EventProperties convertEventToGaussian(const ProbabilityDistributions& histos,
   }
   const unsigned int multMax = events[0].size();
 
-  // Loop over the events
-  EventProperties gaussianEvents;
-  for (const std::vector<float>& event : events) {
-    // Transform the properties in the events
-    std::vector<float> gaussianEvent;
-    for (unsigned int i = 0; i < multMax; i++) {
-      gaussianEvent.push_back(gaussianValue(histos[i], event[i]));
-    }
-    // Store the transformed event
-    gaussianEvents.push_back(gaussianEvent);
+  // Build the cumulative distributions once
+  std::vector<CumulativeDistributionLookup> cumulatives;
+  cumulatives.reserve(multMax);
+  for (unsigned int i = 0; i < multMax; i++) {
+    cumulatives.emplace_back(histos[i]);
   }
+
+  // Transform the properties in the events
+  EventProperties gaussianEvents(events.size());
+  tbbWrap::parallel_for(
+      tbb::blocked_range<std::size_t>(0, events.size()),
+      [&](const tbb::blocked_range<std::size_t>& range) {
+        for (std::size_t k = range.begin(); k != range.end(); ++k) {
+          std::vector<float>& gaussianEvent = gaussianEvents[k];
+          gaussianEvent.reserve(multMax);
+          for (unsigned int i = 0; i < multMax; i++) {
+            gaussianEvent.push_back(
+                gaussianValue(cumulatives[i], events[k][i]));
+          }
+        }
+      });
   return gaussianEvents;
 }
 
@@ -8,7 +8,7 @@
 
 #pragma once
 
-#include "Acts/Propagator/detail/SteppingLogger.hpp"
+#include "ActsExamples/EventData/PropagationSteps.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
@@ -25,9 +25,7 @@ namespace ActsExamples {
 ///     event000000002-propagation-steps.obj
 ///
 /// One Thread per write call and hence thread safe
-template <typename step_t>
-class ObjPropagationStepsWriter
-    : public WriterT<std::vector<std::vector<step_t>>> {
+class ObjPropagationStepsWriter : public WriterT<PropagationStepContainer> {
  public:
   struct Config {
     std::string collection;           ///< which collection to write
@@ -42,8 +40,8 @@ class ObjPropagationStepsWriter
   /// @param level Output logging level
   ObjPropagationStepsWriter(const Config& cfg,
                             Acts::Logging::Level level = Acts::Logging::INFO)
-      : WriterT<std::vector<std::vector<step_t>>>(
-            cfg.collection, "ObjPropagationStepsWriter", level),
+      : WriterT<PropagationStepContainer>(cfg.collection,
+                                          "ObjPropagationStepsWriter", level),
         m_cfg(cfg) {
     if (m_cfg.collection.empty()) {
       throw std::invalid_argument("Missing input collection");
@@ -59,6 +57,9 @@ class ObjPropagationStepsWriter
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
+  /// Journal resume hook
+  bool writesPerEventOutput() const override { return true; }
+
  private:
   Config m_cfg;  ///!< Internal configuration representation
 
@@ -67,7 +68,7 @@ class ObjPropagationStepsWriter
   /// and is called by the WriterT<>::write interface
   ProcessCode writeT(
       const AlgorithmContext& context,
-      const std::vector<std::vector<step_t>>& stepCollection) override {
+      const PropagationStepContainer& stepCollection) override {
     // open per-event file
     std::string path = ActsExamples::perEventFilepath(
         m_cfg.outputDir, "propagation-steps.obj", context.eventNumber);
@@ -79,7 +80,8 @@ class ObjPropagationStepsWriter
     // Initialize the vertex counter
     unsigned int vCounter = 0;
 
-    for (auto& steps : stepCollection) {
+    for (std::size_t ip = 0; ip < stepCollection.size(); ++ip) {
+      const auto steps = stepCollection[ip];
       // At least three points to draw
       if (steps.size() > 2) {
         // We start from one
@@ -116,6 +116,9 @@ class RootAthenaDumpReader : public IReader {
       this, "output_meas_part_map"};
 
   std::unique_ptr<const Acts::Logger> m_logger;
+
+  /// Protects the chain and the branch buffers. It is only held while an
+  /// entry is read and its buffers are transferred to event-local storage.
   std::mutex m_read_mutex;
 
   /// Vector of {eventNr, entryMin, entryMax}
@@ -18,6 +18,8 @@
 #include <Acts/Surfaces/Surface.hpp>
 #include <Acts/Utilities/Logger.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -42,6 +44,11 @@ namespace ActsExamples {
 /// @class RootMaterialDecorator
 ///
 /// @brief Read the collection of SurfaceMaterial & VolumeMaterial
+///
+/// The material can either be read completely at construction, or only be
+/// indexed at construction and read for each surface or volume when it is
+/// first requested. Instead of the ROOT file, a binary cache of the material
+/// maps can be memory-mapped, which is shared between processes.
 class RootMaterialDecorator : public Acts::IMaterialDecorator {
  public:
   /// @class Config
@@ -86,6 +93,12 @@ class RootMaterialDecorator : public Acts::IMaterialDecorator {
     std::string rhotag = "rho";
     /// The name of the output file
     std::string fileName = "material-maps.root";
+    /// Read the material of a surface or volume only when it is first needed
+    bool lazyLoading = false;
+    /// Optional binary cache of the material maps. It is read instead of
+    /// the ROOT file if it was written for the same file path, size,
+    /// modification time and tags, and written from the ROOT file otherwise.
+    std::string cacheFileName;
   };
 
   /// Constructor
@@ -99,37 +112,15 @@ class RootMaterialDecorator : public Acts::IMaterialDecorator {
   /// Decorate a surface
   ///
   /// @param surface the non-cost surface that is decorated
-  void decorate(Acts::Surface& surface) const final {
-    // Null out the material for this surface
-    if (m_clearSurfaceMaterial) {
-      surface.assignSurfaceMaterial(nullptr);
-    }
-    // Try to find the surface in the map
-    auto sMaterial = m_surfaceMaterialMap.find(surface.geometryId());
-    if (sMaterial != m_surfaceMaterialMap.end()) {
-      surface.assignSurfaceMaterial(sMaterial->second);
-    }
-  }
+  void decorate(Acts::Surface& surface) const final;
 
   /// Decorate a TrackingVolume
   ///
   /// @param volume the non-cost volume that is decorated
-  void decorate(Acts::TrackingVolume& volume) const final {
-    // Null out the material for this volume
-    if (m_clearSurfaceMaterial) {
-      volume.assignVolumeMaterial(nullptr);
-    }
-    // Try to find the surface in the map
-    auto vMaterial = m_volumeMaterialMap.find(volume.geometryId());
-    if (vMaterial != m_volumeMaterialMap.end()) {
-      volume.assignVolumeMaterial(vMaterial->second);
-    }
-  }
-
-  /// Return the maps
-  const Acts::DetectorMaterialMaps materialMaps() const {
-    return std::make_pair(m_surfaceMaterialMap, m_volumeMaterialMap);
-  }
+  void decorate(Acts::TrackingVolume& volume) const final;
+
+  /// Return the maps, reading all material which has not been read yet
+  const Acts::DetectorMaterialMaps materialMaps() const;
 
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
@@ -140,14 +131,55 @@ class RootMaterialDecorator : public Acts::IMaterialDecorator {
 
   std::unique_ptr<const Acts::Logger> m_logger{nullptr};
 
+  /// Location of the material of a surface or volume, either the directory
+  /// in the ROOT file or the offset of the record in the cache
+  struct RecordLocation {
+    std::string directory;
+    std::uint64_t offset = 0;
+  };
+
+  /// Index the material directories of the ROOT file
+  void indexInputFile();
+
+  /// Index the records of the memory-mapped cache
+  ///
+  /// @return false if the cache was written for another input
+  bool indexCache();
+
+  /// Write all material of the ROOT file to the cache, and build the
+  /// material from it unless it is read lazily
+  void writeCache() const;
+
+  /// Read the surface material at a location
+  std::shared_ptr<const Acts::ISurfaceMaterial> readSurfaceMaterial(
+      const RecordLocation& location) const;
+
+  /// Read the volume material at a location
+  std::shared_ptr<const Acts::IVolumeMaterial> readVolumeMaterial(
+      const RecordLocation& location) const;
+
+  /// Read all material which has not been read yet, requires the lock
+  void readAllMaterial() const;
+
   /// The input file
   TFile* m_inputFile{nullptr};
 
+  /// The memory-mapped cache
+  const std::byte* m_cacheData{nullptr};
+  std::size_t m_cacheSize{0};
+
+  /// Locations of the surface and volume material
+  std::map<Acts::GeometryIdentifier, RecordLocation> m_surfaceLocations;
+  std::map<Acts::GeometryIdentifier, RecordLocation> m_volumeLocations;
+
+  /// Protects the material maps and the input while reading lazily
+  mutable std::mutex m_readMutex;
+
   /// Surface based material
-  Acts::SurfaceMaterialMap m_surfaceMaterialMap;
+  mutable Acts::SurfaceMaterialMap m_surfaceMaterialMap;
 
   /// Volume based material
-  Acts::VolumeMaterialMap m_volumeMaterialMap;
+  mutable Acts::VolumeMaterialMap m_volumeMaterialMap;
 
   bool m_clearSurfaceMaterial{true};
 
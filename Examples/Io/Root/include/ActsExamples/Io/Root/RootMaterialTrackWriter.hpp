@@ -18,7 +18,6 @@
 #include <cstdint>
 #include <mutex>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -48,8 +47,7 @@ namespace ActsExamples {
 /// It writes out a MaterialTrack which is usually generated from
 /// Geant4 material mapping
 class RootMaterialTrackWriter
-    : public WriterT<
-          std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>> {
+    : public WriterT<std::vector<Acts::RecordedMaterialTrack>> {
  public:
   struct Config {
     /// material collection to write
@@ -86,6 +84,9 @@ class RootMaterialTrackWriter
   /// Framework initialize method
   ActsExamples::ProcessCode finalize() override;
 
+  /// Journal checkpoint hook
+  ActsExamples::ProcessCode flush() override;
+
   /// Readonly access to the config
   const Config& config() const { return m_cfg; }
 
@@ -97,7 +98,7 @@ class RootMaterialTrackWriter
   /// @param clusters is the data to be written out
   ProcessCode writeT(
       const AlgorithmContext& ctx,
-      const std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>&
+      const std::vector<Acts::RecordedMaterialTrack>&
           materialtracks) override;
 
  private:
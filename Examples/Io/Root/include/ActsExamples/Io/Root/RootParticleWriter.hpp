@@ -60,6 +60,9 @@ class RootParticleWriter final : public WriterT<SimParticleContainer> {
   /// End-of-run hook
   ProcessCode finalize() override;
 
+  /// Journal checkpoint hook
+  ProcessCode flush() override;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
@@ -8,8 +8,8 @@
 
 #pragma once
 
-#include "Acts/Propagator/detail/SteppingLogger.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/PropagationSteps.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
@@ -24,8 +24,6 @@ class TTree;
 namespace ActsExamples {
 struct AlgorithmContext;
 
-using PropagationSteps = std::vector<Acts::detail::Step>;
-
 /// @class RootPropagationStepsWriter
 ///
 /// Write out the steps of test propgations for stepping validation,
@@ -37,8 +35,7 @@ using PropagationSteps = std::vector<Acts::detail::Step>;
 /// this is done by setting the Config::rootFile pointer to an existing file
 ///
 /// Safe to use from multiple writer threads - uses a std::mutex lock.
-class RootPropagationStepsWriter
-    : public WriterT<std::vector<PropagationSteps>> {
+class RootPropagationStepsWriter : public WriterT<PropagationStepContainer> {
  public:
   struct Config {
     std::string collection =
@@ -61,6 +58,9 @@ class RootPropagationStepsWriter
   /// End-of-run hook
   ProcessCode finalize() override;
 
+  /// Journal checkpoint hook
+  ProcessCode flush() override;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
@@ -72,7 +72,7 @@ class RootPropagationStepsWriter
   /// @param stepCollection is the data to be written out
   ProcessCode writeT(
       const AlgorithmContext& context,
-      const std::vector<PropagationSteps>& stepCollection) override;
+      const PropagationStepContainer& stepCollection) override;
 
  private:
   Config m_cfg;                    ///< the configuration object
@@ -56,6 +56,9 @@ class RootSimHitWriter final : public WriterT<SimHitContainer> {
   /// End-of-run hook
   ProcessCode finalize() override;
 
+  /// Journal checkpoint hook
+  ProcessCode flush() override;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
@@ -57,6 +57,9 @@ class RootSpacepointWriter final : public WriterT<SimSpacePointContainer> {
   /// End-of-run hook
   ProcessCode finalize() final;
 
+  /// Journal checkpoint hook
+  ProcessCode flush() final;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
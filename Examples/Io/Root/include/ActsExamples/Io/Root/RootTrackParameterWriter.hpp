@@ -73,6 +73,9 @@ class RootTrackParameterWriter final : public TrackParameterWriter {
   /// End-of-run hook
   ProcessCode finalize() override;
 
+  /// Journal checkpoint hook
+  ProcessCode flush() override;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
@@ -78,6 +78,9 @@ class RootTrackStatesWriter final : public WriterT<ConstTrackContainer> {
   /// End-of-run hook
   ProcessCode finalize() override;
 
+  /// Journal checkpoint hook
+  ProcessCode flush() override;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
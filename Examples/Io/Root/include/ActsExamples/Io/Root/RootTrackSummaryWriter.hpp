@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/EventData/SimHit.hpp"
 #include "ActsExamples/EventData/SimParticle.hpp"
@@ -17,6 +18,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
+#include <array>
 #include <cstdint>
 #include <mutex>
 #include <string>
@@ -38,7 +40,9 @@ namespace ActsExamples {
 /// Safe to use from multiple writer threads - uses a std::mutex lock.
 ///
 /// Each entry in the TTree corresponds to all reconstructed tracks in one
-/// single event. The event number is part of the written data.
+/// single event. The event number is part of the written data. The entry is
+/// prepared in parallel over the tracks outside of the lock, only filling
+/// the tree is serialized.
 ///
 /// A common file can be provided for the writer to attach his TTree, this is
 /// done by setting the Config::rootFile pointer to an existing file.
@@ -61,6 +65,9 @@ class RootTrackSummaryWriter final : public WriterT<ConstTrackContainer> {
     std::string fileMode = "RECREATE";
     /// Switch for adding full covariance matrix to output file.
     bool writeCovMat = false;
+    /// Write the covariance matrix as a packed upper triangle into a single
+    /// branch instead of one branch per matrix entry.
+    bool packCovMat = false;
     /// Write GSF specific things (for now only some material statistics)
     bool writeGsfSpecific = false;
     /// Write GX2F specific things
@@ -77,6 +84,9 @@ class RootTrackSummaryWriter final : public WriterT<ConstTrackContainer> {
   /// End-of-run hook
   ProcessCode finalize() override;
 
+  /// Journal checkpoint hook
+  ProcessCode flush() override;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
@@ -103,178 +113,104 @@ class RootTrackSummaryWriter final : public WriterT<ConstTrackContainer> {
   TTree* m_outputTree{nullptr};
   /// The event number
   std::uint32_t m_eventNr{0};
-  /// The track number in event
-  std::vector<std::uint32_t> m_trackNr;
-
-  /// The number of states
-  std::vector<unsigned int> m_nStates;
-  /// The number of measurements
-  std::vector<unsigned int> m_nMeasurements;
-  /// The number of outliers
-  std::vector<unsigned int> m_nOutliers;
-  /// The number of holes
-  std::vector<unsigned int> m_nHoles;
-  /// The number of shared hits
-  std::vector<unsigned int> m_nSharedHits;
-  /// The total chi2
-  std::vector<float> m_chi2Sum;
-  /// The number of ndf of the measurements+outliers
-  std::vector<unsigned int> m_NDF;
-  /// The chi2 on all measurement states
-  std::vector<std::vector<double>> m_measurementChi2;
-  /// The chi2 on all outlier states
-  std::vector<std::vector<double>> m_outlierChi2;
-  /// The volume id of the measurements
-  std::vector<std::vector<std::uint32_t>> m_measurementVolume;
-  /// The layer id of the measurements
-  std::vector<std::vector<std::uint32_t>> m_measurementLayer;
-  /// The volume id of the outliers
-  std::vector<std::vector<std::uint32_t>> m_outlierVolume;
-  /// The layer id of the outliers
-  std::vector<std::vector<std::uint32_t>> m_outlierLayer;
-
-  // The majority truth particle info
-  /// The number of hits from majority particle
-  std::vector<unsigned int> m_nMajorityHits;
-  /// The particle Id of the majority particle
-  std::vector<std::uint64_t> m_majorityParticleId;
-  /// The classification of the reconstructed track
-  std::vector<int> m_trackClassification;
-  /// Charge of majority particle
-  std::vector<int> m_t_charge;
-  /// Time of majority particle
-  std::vector<float> m_t_time;
-  /// Vertex x positions of majority particle
-  std::vector<float> m_t_vx;
-  /// Vertex y positions of majority particle
-  std::vector<float> m_t_vy;
-  /// Vertex z positions of majority particle
-  std::vector<float> m_t_vz;
-  /// Initial momenta px of majority particle
-  std::vector<float> m_t_px;
-  /// Initial momenta py of majority particle
-  std::vector<float> m_t_py;
-  /// Initial momenta pz of majority particle
-  std::vector<float> m_t_pz;
-  /// Initial momenta theta of majority particle
-  std::vector<float> m_t_theta;
-  /// Initial momenta phi of majority particle
-  std::vector<float> m_t_phi;
-  /// Initial abs momenta of majority particle
-  std::vector<float> m_t_p;
-  /// Initial momenta pT of majority particle
-  std::vector<float> m_t_pT;
-  /// Initial momenta eta of majority particle
-  std::vector<float> m_t_eta;
-  /// The extrapolated truth transverse impact parameter
-  std::vector<float> m_t_d0;
-  /// The extrapolated truth longitudinal impact parameter
-  std::vector<float> m_t_z0;
-
-  /// If the track has fitted parameter
-  std::vector<bool> m_hasFittedParams;
-  // The fitted parameters
-  /// Fitted parameters eBoundLoc0 of track
-  std::vector<float> m_eLOC0_fit;
-  /// Fitted parameters eBoundLoc1 of track
-  std::vector<float> m_eLOC1_fit;
-  /// Fitted parameters ePHI of track
-  std::vector<float> m_ePHI_fit;
-  /// Fitted parameters eTHETA of track
-  std::vector<float> m_eTHETA_fit;
-  /// Fitted parameters eQOP of track
-  std::vector<float> m_eQOP_fit;
-  /// Fitted parameters eT of track
-  std::vector<float> m_eT_fit;
-  // The error of fitted parameters
-  /// Fitted parameters eLOC err of track
-  std::vector<float> m_err_eLOC0_fit;
-  /// Fitted parameters eBoundLoc1 err of track
-  std::vector<float> m_err_eLOC1_fit;
-  /// Fitted parameters ePHI err of track
-  std::vector<float> m_err_ePHI_fit;
-  /// Fitted parameters eTHETA err of track
-  std::vector<float> m_err_eTHETA_fit;
-  /// Fitted parameters eQOP err of track
-  std::vector<float> m_err_eQOP_fit;
-  /// Fitted parameters eT err of track
-  std::vector<float> m_err_eT_fit;
-  // The residual of fitted parameters
-  /// Fitted parameters eLOC res of track
-  std::vector<float> m_res_eLOC0_fit;
-  /// Fitted parameters eBoundLoc1 res of track
-  std::vector<float> m_res_eLOC1_fit;
-  /// Fitted parameters ePHI res of track
-  std::vector<float> m_res_ePHI_fit;
-  /// Fitted parameters eTHETA res of track
-  std::vector<float> m_res_eTHETA_fit;
-  /// Fitted parameters eQOP res of track
-  std::vector<float> m_res_eQOP_fit;
-  /// Fitted parameters eT res of track
-  std::vector<float> m_res_eT_fit;
-  // The pull of fitted parameters
-  /// Fitted parameters eLOC pull of track
-  std::vector<float> m_pull_eLOC0_fit;
-  /// Fitted parameters eBoundLoc1 pull of track
-  std::vector<float> m_pull_eLOC1_fit;
-  /// Fitted parameters ePHI pull of track
-  std::vector<float> m_pull_ePHI_fit;
-  /// Fitted parameters eTHETA pull of track
-  std::vector<float> m_pull_eTHETA_fit;
-  /// Fitted parameters eQOP pull of track
-  std::vector<float> m_pull_eQOP_fit;
-  /// Fitted parameters eT pull of track
-  std::vector<float> m_pull_eT_fit;
-
-  // entries of the full covariance matrix. One block for every row of the
-  // matrix
-  std::vector<float> m_cov_eLOC0_eLOC0;
-  std::vector<float> m_cov_eLOC0_eLOC1;
-  std::vector<float> m_cov_eLOC0_ePHI;
-  std::vector<float> m_cov_eLOC0_eTHETA;
-  std::vector<float> m_cov_eLOC0_eQOP;
-  std::vector<float> m_cov_eLOC0_eT;
-
-  std::vector<float> m_cov_eLOC1_eLOC0;
-  std::vector<float> m_cov_eLOC1_eLOC1;
-  std::vector<float> m_cov_eLOC1_ePHI;
-  std::vector<float> m_cov_eLOC1_eTHETA;
-  std::vector<float> m_cov_eLOC1_eQOP;
-  std::vector<float> m_cov_eLOC1_eT;
 
-  std::vector<float> m_cov_ePHI_eLOC0;
-  std::vector<float> m_cov_ePHI_eLOC1;
-  std::vector<float> m_cov_ePHI_ePHI;
-  std::vector<float> m_cov_ePHI_eTHETA;
-  std::vector<float> m_cov_ePHI_eQOP;
-  std::vector<float> m_cov_ePHI_eT;
-
-  std::vector<float> m_cov_eTHETA_eLOC0;
-  std::vector<float> m_cov_eTHETA_eLOC1;
-  std::vector<float> m_cov_eTHETA_ePHI;
-  std::vector<float> m_cov_eTHETA_eTHETA;
-  std::vector<float> m_cov_eTHETA_eQOP;
-  std::vector<float> m_cov_eTHETA_eT;
-
-  std::vector<float> m_cov_eQOP_eLOC0;
-  std::vector<float> m_cov_eQOP_eLOC1;
-  std::vector<float> m_cov_eQOP_ePHI;
-  std::vector<float> m_cov_eQOP_eTHETA;
-  std::vector<float> m_cov_eQOP_eQOP;
-  std::vector<float> m_cov_eQOP_eT;
-
-  std::vector<float> m_cov_eT_eLOC0;
-  std::vector<float> m_cov_eT_eLOC1;
-  std::vector<float> m_cov_eT_ePHI;
-  std::vector<float> m_cov_eT_eTHETA;
-  std::vector<float> m_cov_eT_eQOP;
-  std::vector<float> m_cov_eT_eT;
-
-  std::vector<float> m_gsf_max_material_fwd;
-  std::vector<float> m_gsf_sum_material_fwd;
+  /// The per-event columns of the tree with one entry per track
+  struct Columns {
+    /// The track number in event
+    std::vector<std::uint32_t> trackNr;
+
+    /// The number of states
+    std::vector<unsigned int> nStates;
+    /// The number of measurements
+    std::vector<unsigned int> nMeasurements;
+    /// The number of outliers
+    std::vector<unsigned int> nOutliers;
+    /// The number of holes
+    std::vector<unsigned int> nHoles;
+    /// The number of shared hits
+    std::vector<unsigned int> nSharedHits;
+    /// The total chi2
+    std::vector<float> chi2Sum;
+    /// The number of ndf of the measurements+outliers
+    std::vector<unsigned int> NDF;
+    /// The chi2 on all measurement states
+    std::vector<std::vector<double>> measurementChi2;
+    /// The chi2 on all outlier states
+    std::vector<std::vector<double>> outlierChi2;
+    /// The volume id of the measurements
+    std::vector<std::vector<std::uint32_t>> measurementVolume;
+    /// The layer id of the measurements
+    std::vector<std::vector<std::uint32_t>> measurementLayer;
+    /// The volume id of the outliers
+    std::vector<std::vector<std::uint32_t>> outlierVolume;
+    /// The layer id of the outliers
+    std::vector<std::vector<std::uint32_t>> outlierLayer;
+
+    // The majority truth particle info
+    /// The number of hits from majority particle
+    std::vector<unsigned int> nMajorityHits;
+    /// The particle Id of the majority particle
+    std::vector<std::uint64_t> majorityParticleId;
+    /// The classification of the reconstructed track
+    std::vector<int> trackClassification;
+    /// Charge of majority particle
+    std::vector<int> t_charge;
+    /// Time of majority particle
+    std::vector<float> t_time;
+    /// Vertex x positions of majority particle
+    std::vector<float> t_vx;
+    /// Vertex y positions of majority particle
+    std::vector<float> t_vy;
+    /// Vertex z positions of majority particle
+    std::vector<float> t_vz;
+    /// Initial momenta px of majority particle
+    std::vector<float> t_px;
+    /// Initial momenta py of majority particle
+    std::vector<float> t_py;
+    /// Initial momenta pz of majority particle
+    std::vector<float> t_pz;
+    /// Initial momenta theta of majority particle
+    std::vector<float> t_theta;
+    /// Initial momenta phi of majority particle
+    std::vector<float> t_phi;
+    /// Initial abs momenta of majority particle
+    std::vector<float> t_p;
+    /// Initial momenta pT of majority particle
+    std::vector<float> t_pT;
+    /// Initial momenta eta of majority particle
+    std::vector<float> t_eta;
+    /// The extrapolated truth transverse impact parameter
+    std::vector<float> t_d0;
+    /// The extrapolated truth longitudinal impact parameter
+    std::vector<float> t_z0;
+
+    /// If the track has fitted parameter
+    std::vector<bool> hasFittedParams;
+    /// Fitted parameters of track, one column per parameter
+    std::array<std::vector<float>, Acts::eBoundSize> fit;
+    /// Error of the fitted parameters of track
+    std::array<std::vector<float>, Acts::eBoundSize> err;
+    /// Residual of the fitted parameters of track
+    std::array<std::vector<float>, Acts::eBoundSize> res;
+    /// Pull of the fitted parameters of track
+    std::array<std::vector<float>, Acts::eBoundSize> pull;
+
+    /// Entries of the full covariance matrix, one column for every entry of
+    /// the matrix in row-major order
+    std::array<std::vector<float>, Acts::eBoundSize * Acts::eBoundSize> cov;
+    /// Packed upper triangle of the covariance matrix in row-major order,
+    /// one block of consecutive entries per track
+    std::vector<float> covPacked;
+
+    std::vector<float> gsf_max_material_fwd;
+    std::vector<float> gsf_sum_material_fwd;
+
+    /// The number of updates (gx2f)
+    std::vector<int> nUpdatesGx2f;
+  };
 
-  /// The number of updates (gx2f)
-  std::vector<int> m_nUpdatesGx2f;
+  /// The columns connected to the tree branches
+  Columns m_columns;
 };
 
 }  // namespace ActsExamples
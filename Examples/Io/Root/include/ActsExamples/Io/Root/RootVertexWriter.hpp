@@ -57,6 +57,9 @@ class RootVertexWriter final : public WriterT<SimVertexContainer> {
   /// End-of-run hook
   ProcessCode finalize() override;
 
+  /// Journal checkpoint hook
+  ProcessCode flush() override;
+
   /// Get readonly access to the config parameters
   const Config& config() const { return m_cfg; }
 
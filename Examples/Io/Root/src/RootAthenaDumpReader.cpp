@@ -14,9 +14,14 @@
 #include "ActsExamples/EventData/Cluster.hpp"
 #include "ActsExamples/EventData/GeometryContainers.hpp"
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 #include <ActsExamples/Digitization/MeasurementCreation.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <numeric>
+#include <optional>
+#include <type_traits>
 
 #include <TChain.h>
 #include <boost/container/static_vector.hpp>
@@ -264,7 +269,10 @@ ActsExamples::ProcessCode ActsExamples::RootAthenaDumpReader::read(
     return ProcessCode::ABORT;
   }
 
-  std::lock_guard<std::mutex> lock(m_read_mutex);
+  // Only the reading of the entry and the transfer of the branch buffers
+  // into event-local storage happens under the lock, the decoding is done
+  // afterwards and can run concurrently for different events.
+  std::unique_lock<std::mutex> lock(m_read_mutex);
 
   m_inputchain->GetEntry(entry);
 
@@ -295,28 +303,76 @@ ActsExamples::ProcessCode ActsExamples::RootAthenaDumpReader::read(
     particles.insert(particle);
   }
 
-  ClusterContainer clusters(nCL);
-  MeasurementContainer measurements;
-  measurements.reserve(nCL);
-
-  IndexMultimap<ActsFatras::Barcode> measPartMap;
-
-  for (int im = 0; im < nCL; im++) {
-    if (!(CLhardware->at(im) == "PIXEL" || CLhardware->at(im) == "STRIP")) {
+  // The variable-size branches are swapped out, ROOT refills the emptied
+  // objects on the next entry
+  const int nClusters = nCL;
+  std::vector<std::string> hardware;
+  std::vector<std::vector<int>> clEtas;
+  std::vector<std::vector<int>> clTots;
+  std::vector<std::vector<double>> clLocalCov;
+  std::vector<std::vector<int>> clParticleEventIndex;
+  std::vector<std::vector<int>> clParticleBarcode;
+  hardware.swap(*CLhardware);
+  clEtas.swap(*CLetas);
+  clTots.swap(*CLtots);
+  clLocalCov.swap(*CLlocal_cov);
+  clParticleEventIndex.swap(*CLparticleLink_eventIndex);
+  clParticleBarcode.swap(*CLparticleLink_barcode);
+
+  auto copyBranch = [](const auto* buffer, int n) {
+    using Value = std::remove_cv_t<std::remove_pointer_t<decltype(buffer)>>;
+    return std::vector<Value>(buffer, buffer + std::max(n, 0));
+  };
+  const auto clX = copyBranch(CLx, nClusters);
+  const auto clY = copyBranch(CLy, nClusters);
+  const auto clZ = copyBranch(CLz, nClusters);
+  const auto clModuleId = copyBranch(CLmoduleID, nClusters);
+  const auto clChargeCount = copyBranch(CLcharge_count, nClusters);
+  const auto clLocDirection1 = copyBranch(CLloc_direction1, nClusters);
+  const auto clLocDirection2 = copyBranch(CLloc_direction2, nClusters);
+  const auto clLocDirection3 = copyBranch(CLloc_direction3, nClusters);
+
+  const int nSpacePoints = nSP;
+  const auto spX = copyBranch(SPx, nSpacePoints);
+  const auto spY = copyBranch(SPy, nSpacePoints);
+  const auto spZ = copyBranch(SPz, nSpacePoints);
+  const auto spCovR = copyBranch(SPcovr, nSpacePoints);
+  const auto spCovZ = copyBranch(SPcovz, nSpacePoints);
+  const auto spCl1Index = copyBranch(SPCL1_index, nSpacePoints);
+  const auto spCl2Index = copyBranch(SPCL2_index, nSpacePoints);
+  const auto spIsOverlap = copyBranch(SPisOverlap, nSpacePoints);
+
+  lock.unlock();
+
+  // Decode the hardware type once per cluster instead of comparing strings
+  std::vector<SpacePointType> clType(nClusters);
+  for (int im = 0; im < nClusters; im++) {
+    if (hardware.at(im) == "PIXEL") {
+      clType[im] = ePixel;
+    } else if (hardware.at(im) == "STRIP") {
+      clType[im] = eStrip;
+    } else {
       ACTS_ERROR("hardware is neither 'PIXEL' or 'STRIP'");
       return ActsExamples::ProcessCode::ABORT;
     }
-    ACTS_VERBOSE("Cluster " << im << ": " << CLhardware->at(im));
+    ACTS_VERBOSE("Cluster " << im << ": " << hardware[im]);
+  }
 
-    auto type = (CLhardware->at(im) == "PIXEL") ? ePixel : eStrip;
+  ClusterContainer clusters(nClusters);
+  std::vector<std::optional<Measurement>> clMeasurements(nClusters);
+
+  // Clusters and measurements only depend on their own cluster, so they can
+  // be built in parallel
+  auto buildCluster = [&](int im) {
+    const auto type = clType[im];
 
     // Make cluster
     // TODO refactor ActsExamples::Cluster class so it is not so tedious
     Cluster cluster;
 
-    const auto& etas = CLetas->at(im);
-    const auto& phis = CLetas->at(im);
-    const auto& tots = CLtots->at(im);
+    const auto& etas = clEtas.at(im);
+    const auto& phis = clEtas.at(im);
+    const auto& tots = clTots.at(im);
 
     const auto totalTot = std::accumulate(tots.begin(), tots.end(), 0);
 
@@ -326,12 +382,13 @@ ActsExamples::ProcessCode ActsExamples::RootAthenaDumpReader::read(
     cluster.sizeLoc0 = *maxEta - *minEta;
     cluster.sizeLoc1 = *maxPhi - *minPhi;
 
+    cluster.channels.reserve(etas.size());
     for (const auto& [eta, phi, tot] : Acts::zip(etas, phis, tots)) {
       // Make best out of what we have:
       // Weight the overall collected charge corresponding to the
       // time-over-threshold of each cell Use this as activation (does this make
       // sense?)
-      auto activation = CLcharge_count[im] * tot / totalTot;
+      auto activation = clChargeCount[im] * tot / totalTot;
 
       // This bases every cluster at zero, but shouldn't matter right now
       ActsFatras::Segmentizer::Bin2D bin;
@@ -343,40 +400,58 @@ ActsExamples::ProcessCode ActsExamples::RootAthenaDumpReader::read(
                                     activation);
     }
 
-    cluster.globalPosition = {CLx[im], CLy[im], CLz[im]};
+    cluster.globalPosition = {clX[im], clY[im], clZ[im]};
 
     ACTS_VERBOSE("CL shape: " << cluster.channels.size()
                               << "cells, dimensions: " << cluster.sizeLoc0
                               << ", " << cluster.sizeLoc1);
 
-    clusters[im] = cluster;
+    clusters[im] = std::move(cluster);
 
     // Measurement creation
-    ACTS_VERBOSE("CL loc dims:" << CLloc_direction1[im] << ", "
-                                << CLloc_direction2[im] << ", "
-                                << CLloc_direction3[im]);
-    const auto& locCov = CLlocal_cov->at(im);
+    ACTS_VERBOSE("CL loc dims:" << clLocDirection1[im] << ", "
+                                << clLocDirection2[im] << ", "
+                                << clLocDirection3[im]);
+    const auto& locCov = clLocalCov.at(im);
 
     DigitizedParameters digiPars;
     if (type == ePixel) {
       digiPars.indices = {Acts::eBoundLoc0, Acts::eBoundLoc1};
-      digiPars.values = {CLloc_direction1[im], CLloc_direction2[im]};
+      digiPars.values = {clLocDirection1[im], clLocDirection2[im]};
       assert(locCov.size() == 4);
       digiPars.variances = {locCov[0], locCov[3]};
     } else {
-      digiPars.values = {CLloc_direction1[im]};
+      digiPars.values = {clLocDirection1[im]};
       digiPars.indices = {Acts::eBoundLoc0};
       assert(!locCov.empty());
       digiPars.variances = {locCov[0]};
     }
 
-    IndexSourceLink sl(Acts::GeometryIdentifier{CLmoduleID[im]}, im);
+    IndexSourceLink sl(Acts::GeometryIdentifier{clModuleId[im]}, im);
+
+    clMeasurements[im] = createMeasurement(digiPars, sl);
+  };
+
+  tbbWrap::parallel_for(tbb::blocked_range<int>(0, nClusters),
+                        [&](const tbb::blocked_range<int>& range) {
+                          for (int im = range.begin(); im != range.end();
+                               ++im) {
+                            buildCluster(im);
+                          }
+                        });
 
-    measurements.push_back(createMeasurement(digiPars, sl));
+  MeasurementContainer measurements;
+  measurements.reserve(nClusters);
+  for (auto& measurement : clMeasurements) {
+    measurements.push_back(std::move(*measurement));
+  }
 
-    // Create measurement particles map and particles container
-    for (const auto& [subevt, bc] : Acts::zip(CLparticleLink_eventIndex->at(im),
-                                              CLparticleLink_barcode->at(im))) {
+  // Create measurement particles map. This stays serial since the barcodes
+  // are assigned in order of appearance.
+  IndexMultimap<ActsFatras::Barcode> measPartMap;
+  for (int im = 0; im < nClusters; im++) {
+    for (const auto& [subevt, bc] :
+         Acts::zip(clParticleEventIndex.at(im), clParticleBarcode.at(im))) {
       auto barcode = barcodeConstructor.getBarcode(bc, subevt);
       measPartMap.insert(std::pair<Index, ActsFatras::Barcode>{im, barcode});
     }
@@ -391,9 +466,9 @@ ActsExamples::ProcessCode ActsExamples::RootAthenaDumpReader::read(
 
   // Loop on space points
   std::size_t skippedSpacePoints = 0;
-  for (int isp = 0; isp < nSP; isp++) {
-    auto isPhiOverlap = (SPisOverlap[isp] == 2) || (SPisOverlap[isp] == 3);
-    auto isEtaOverlap = (SPisOverlap[isp] == 1) || (SPisOverlap[isp] == 3);
+  for (int isp = 0; isp < nSpacePoints; isp++) {
+    auto isPhiOverlap = (spIsOverlap[isp] == 2) || (spIsOverlap[isp] == 3);
+    auto isEtaOverlap = (spIsOverlap[isp] == 1) || (spIsOverlap[isp] == 3);
     if (m_cfg.skipOverlapSPsPhi && isPhiOverlap) {
       ++skippedSpacePoints;
       continue;
@@ -403,34 +478,34 @@ ActsExamples::ProcessCode ActsExamples::RootAthenaDumpReader::read(
       continue;
     }
 
-    Acts::Vector3 globalPos{SPx[isp], SPy[isp], SPz[isp]};
-    double sp_covr = SPcovr[isp];
-    double sp_covz = SPcovz[isp];
+    Acts::Vector3 globalPos{spX[isp], spY[isp], spZ[isp]};
+    double sp_covr = spCovR[isp];
+    double sp_covz = spCovZ[isp];
 
     // PIX=1  STRIP = 2
-    auto type = SPCL2_index[isp] == -1 ? ePixel : eStrip;
+    auto type = spCl2Index[isp] == -1 ? ePixel : eStrip;
 
     ACTS_VERBOSE("SP:: " << type << " [" << globalPos.transpose() << "] "
                          << sp_covr << " " << sp_covz);
 
     boost::container::static_vector<Acts::SourceLink, 2> sLinks;
 
-    const auto cl1Index = SPCL1_index[isp];
-    assert(cl1Index >= 0 && cl1Index < nCL);
+    const auto cl1Index = spCl1Index[isp];
+    assert(cl1Index >= 0 && cl1Index < nClusters);
 
     // NOTE This of course does not produce a valid Acts-stlye geometry id, but
     // we can use it for the module map
-    IndexSourceLink first(Acts::GeometryIdentifier{CLmoduleID[cl1Index]},
+    IndexSourceLink first(Acts::GeometryIdentifier{clModuleId[cl1Index]},
                           cl1Index);
     sLinks.emplace_back(first);
 
     if (type == eStrip) {
-      const auto cl2Index = SPCL2_index[isp];
-      assert(cl2Index >= 0 && cl2Index < nCL);
+      const auto cl2Index = spCl2Index[isp];
+      assert(cl2Index >= 0 && cl2Index < nClusters);
 
       // NOTE This of course does not produce a valid Acts-stlye geometry id,
       // but we can use it for the module map
-      IndexSourceLink second(Acts::GeometryIdentifier{CLmoduleID[cl2Index]},
+      IndexSourceLink second(Acts::GeometryIdentifier{clModuleId[cl2Index]},
                              cl2Index);
       sLinks.emplace_back(second);
     }
@@ -23,11 +23,17 @@
 #include <Acts/Utilities/BinningType.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 #include <tuple>
 #include <vector>
 
@@ -41,12 +47,430 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/finder.hpp>
 #include <boost/algorithm/string/iter_find.hpp>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace Acts {
 class ISurfaceMaterial;
 class IVolumeMaterial;
 }  // namespace Acts
 
+namespace {
+
+using Config = ActsExamples::RootMaterialDecorator::Config;
+
+/// Raw content of a material directory, as read from the ROOT file or from
+/// the binary cache
+struct MaterialRecord {
+  /// All histograms required for the material are present
+  bool valid = false;
+  /// Binning per dimension: number of bins, value, option, min and max
+  std::vector<std::array<float, 5>> binning;
+  /// Number of bins of the material values in the first and second dimension
+  std::uint32_t nBins0 = 0;
+  std::uint32_t nBins1 = 0;
+  /// Material values with the first dimension running fastest: t, x0, l0, A,
+  /// Z and rho for surfaces, and the same without t for volumes
+  std::vector<std::vector<float>> values;
+};
+
+/// Magic number and version of the binary material cache. The cache is
+/// written in native byte order and laid out as
+///   magic, version, source path, size and modification time, tags,
+///   number of surfaces and volumes,
+///   (geometry id, record offset) for all surfaces and then all volumes,
+///   records: valid, dimensions, bins 0, bins 1, number of value arrays,
+///            binning and value arrays as floats
+/// Strings are stored as their length followed by the characters.
+constexpr std::array<char, 8> s_cacheMagic = {'A', 'C', 'T', 'S',
+                                              'M', 'A', 'T', '\0'};
+constexpr std::uint32_t s_cacheVersion = 2;
+
+/// The ROOT file and the configuration a cache is written for. A cache is
+/// only used if it was written for the current source.
+struct CacheSource {
+  std::string path;
+  std::uint64_t size = 0;
+  std::int64_t modificationTime = 0;
+  /// All folder names and tags, which decide what is read from the file
+  std::string tags;
+
+  bool operator==(const CacheSource& other) const {
+    return std::tie(path, size, modificationTime, tags) ==
+           std::tie(other.path, other.size, other.modificationTime,
+                    other.tags);
+  }
+  bool operator!=(const CacheSource& other) const { return !(*this == other); }
+};
+
+/// Describe the ROOT file and the configuration of the decorator
+CacheSource cacheSource(const Config& cfg) {
+  CacheSource source;
+  std::error_code ec;
+  const auto path = std::filesystem::weakly_canonical(cfg.fileName, ec);
+  if (!ec) {
+    source.size = std::filesystem::file_size(path, ec);
+  }
+  if (!ec) {
+    source.modificationTime = std::filesystem::last_write_time(path, ec)
+                                  .time_since_epoch()
+                                  .count();
+  }
+  if (ec) {
+    throw std::ios_base::failure("Could not open '" + cfg.fileName + "'");
+  }
+  source.path = path.string();
+  for (const std::string* tag :
+       {&cfg.folderSurfaceNameBase, &cfg.folderVolumeNameBase, &cfg.voltag,
+        &cfg.boutag, &cfg.laytag, &cfg.apptag, &cfg.sentag, &cfg.ntag,
+        &cfg.vtag, &cfg.otag, &cfg.mintag, &cfg.maxtag, &cfg.ttag, &cfg.x0tag,
+        &cfg.l0tag, &cfg.atag, &cfg.ztag, &cfg.rhotag}) {
+    source.tags += *tag;
+    source.tags += '\n';
+  }
+  return source;
+}
+
+template <typename hist_t>
+std::unique_ptr<hist_t> getHistogram(TFile& file, const std::string& name) {
+  return std::unique_ptr<hist_t>(dynamic_cast<hist_t*>(file.Get(name.c_str())));
+}
+
+/// Read the binning histograms of a material directory
+bool readRootBinning(TFile& file, const Config& cfg, const std::string& base,
+                     MaterialRecord& record) {
+  auto n = getHistogram<TH1F>(file, base + cfg.ntag);
+  auto v = getHistogram<TH1F>(file, base + cfg.vtag);
+  auto o = getHistogram<TH1F>(file, base + cfg.otag);
+  auto min = getHistogram<TH1F>(file, base + cfg.mintag);
+  auto max = getHistogram<TH1F>(file, base + cfg.maxtag);
+  if (n == nullptr || v == nullptr || o == nullptr || min == nullptr ||
+      max == nullptr) {
+    return false;
+  }
+  for (int ib = 1; ib < n->GetNbinsX() + 1; ++ib) {
+    record.binning.push_back({static_cast<float>(n->GetBinContent(ib)),
+                              static_cast<float>(v->GetBinContent(ib)),
+                              static_cast<float>(o->GetBinContent(ib)),
+                              static_cast<float>(min->GetBinContent(ib)),
+                              static_cast<float>(max->GetBinContent(ib))});
+  }
+  return true;
+}
+
+/// Read the surface material directory from the ROOT file
+MaterialRecord readRootSurfaceRecord(TFile& file, const Config& cfg,
+                                     const std::string& tdName) {
+  MaterialRecord record;
+  const std::string base = tdName + "/";
+  bool hasBinning = readRootBinning(file, cfg, base, record);
+  std::array<std::unique_ptr<TH2F>, 6> hists = {
+      getHistogram<TH2F>(file, base + cfg.ttag),
+      getHistogram<TH2F>(file, base + cfg.x0tag),
+      getHistogram<TH2F>(file, base + cfg.l0tag),
+      getHistogram<TH2F>(file, base + cfg.atag),
+      getHistogram<TH2F>(file, base + cfg.ztag),
+      getHistogram<TH2F>(file, base + cfg.rhotag)};
+
+  // Only go on when you have all histograms
+  if (!hasBinning ||
+      std::any_of(hists.begin(), hists.end(),
+                  [](const auto& hist) { return hist == nullptr; })) {
+    return MaterialRecord();
+  }
+  record.valid = true;
+  record.nBins0 = hists[0]->GetNbinsX();
+  record.nBins1 = hists[0]->GetNbinsY();
+  for (const auto& hist : hists) {
+    auto& values = record.values.emplace_back();
+    values.reserve(record.nBins0 * record.nBins1);
+    for (std::uint32_t ib1 = 1; ib1 <= record.nBins1; ++ib1) {
+      for (std::uint32_t ib0 = 1; ib0 <= record.nBins0; ++ib0) {
+        values.push_back(hist->GetBinContent(ib0, ib1));
+      }
+    }
+  }
+  return record;
+}
+
+/// Read the volume material directory from the ROOT file
+MaterialRecord readRootVolumeRecord(TFile& file, const Config& cfg,
+                                    const std::string& tdName) {
+  MaterialRecord record;
+  const std::string base = tdName + "/";
+  // The binning is only present for 2D or 3D grids
+  if (!readRootBinning(file, cfg, base, record)) {
+    record.binning.clear();
+  }
+  std::array<std::unique_ptr<TH1F>, 5> hists = {
+      getHistogram<TH1F>(file, base + cfg.x0tag),
+      getHistogram<TH1F>(file, base + cfg.l0tag),
+      getHistogram<TH1F>(file, base + cfg.atag),
+      getHistogram<TH1F>(file, base + cfg.ztag),
+      getHistogram<TH1F>(file, base + cfg.rhotag)};
+
+  // Only go on when you have all the material histograms
+  if (std::any_of(hists.begin(), hists.end(),
+                  [](const auto& hist) { return hist == nullptr; })) {
+    return MaterialRecord();
+  }
+  record.valid = true;
+  record.nBins0 = hists[0]->GetNbinsX();
+  record.nBins1 = 1;
+  for (const auto& hist : hists) {
+    auto& values = record.values.emplace_back();
+    values.reserve(record.nBins0);
+    for (std::uint32_t p = 1; p <= record.nBins0; ++p) {
+      values.push_back(hist->GetBinContent(p));
+    }
+  }
+  return record;
+}
+
+template <typename T>
+void appendRaw(std::string& buffer, const T& value) {
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void appendString(std::string& buffer, const std::string& value) {
+  appendRaw(buffer, static_cast<std::uint64_t>(value.size()));
+  buffer.append(value);
+}
+
+template <typename T>
+T readRaw(const std::byte* data, std::size_t size, std::size_t& pos) {
+  if (pos + sizeof(T) > size) {
+    throw std::runtime_error("Truncated material cache");
+  }
+  T value;
+  std::memcpy(&value, data + pos, sizeof(T));
+  pos += sizeof(T);
+  return value;
+}
+
+std::string readString(const std::byte* data, std::size_t size,
+                       std::size_t& pos) {
+  auto length = readRaw<std::uint64_t>(data, size, pos);
+  if (length > size - pos) {
+    throw std::runtime_error("Truncated material cache");
+  }
+  std::string value(reinterpret_cast<const char*>(data + pos), length);
+  pos += length;
+  return value;
+}
+
+/// Append the source description to the cache header
+void writeCacheSource(std::string& buffer, const CacheSource& source) {
+  appendString(buffer, source.path);
+  appendRaw(buffer, source.size);
+  appendRaw(buffer, source.modificationTime);
+  appendString(buffer, source.tags);
+}
+
+/// Read the source description from the cache header
+CacheSource readCacheSource(const std::byte* data, std::size_t size,
+                            std::size_t& pos) {
+  CacheSource source;
+  source.path = readString(data, size, pos);
+  source.size = readRaw<std::uint64_t>(data, size, pos);
+  source.modificationTime = readRaw<std::int64_t>(data, size, pos);
+  source.tags = readString(data, size, pos);
+  return source;
+}
+
+/// Append a record to the cache buffer
+void writeCacheRecord(std::string& buffer, const MaterialRecord& record) {
+  appendRaw(buffer, static_cast<std::uint32_t>(record.valid));
+  appendRaw(buffer, static_cast<std::uint32_t>(record.binning.size()));
+  appendRaw(buffer, record.nBins0);
+  appendRaw(buffer, record.nBins1);
+  appendRaw(buffer, static_cast<std::uint32_t>(record.values.size()));
+  for (const auto& binning : record.binning) {
+    appendRaw(buffer, binning);
+  }
+  for (const auto& values : record.values) {
+    buffer.append(reinterpret_cast<const char*>(values.data()),
+                  values.size() * sizeof(float));
+  }
+}
+
+/// Read a record from the memory-mapped cache
+MaterialRecord readCacheRecord(const std::byte* data, std::size_t size,
+                               std::size_t pos) {
+  MaterialRecord record;
+  record.valid = readRaw<std::uint32_t>(data, size, pos) != 0;
+  auto nDims = readRaw<std::uint32_t>(data, size, pos);
+  record.nBins0 = readRaw<std::uint32_t>(data, size, pos);
+  record.nBins1 = readRaw<std::uint32_t>(data, size, pos);
+  auto nArrays = readRaw<std::uint32_t>(data, size, pos);
+  for (std::uint32_t id = 0; id < nDims; ++id) {
+    record.binning.push_back(
+        readRaw<std::array<float, 5>>(data, size, pos));
+  }
+  const std::size_t nValues =
+      static_cast<std::size_t>(record.nBins0) * record.nBins1;
+  for (std::uint32_t ia = 0; ia < nArrays; ++ia) {
+    if (pos + nValues * sizeof(float) > size) {
+      throw std::runtime_error("Truncated material cache");
+    }
+    auto& values = record.values.emplace_back(nValues);
+    std::memcpy(values.data(), data + pos, nValues * sizeof(float));
+    pos += nValues * sizeof(float);
+  }
+  return record;
+}
+
+/// Reconstruct the bin utility of a record
+Acts::BinUtility binUtility(const MaterialRecord& record) {
+  Acts::BinUtility bUtility;
+  for (const auto& [nbins, val, opt, rmin, rmax] : record.binning) {
+    bUtility += Acts::BinUtility(static_cast<std::size_t>(nbins), rmin, rmax,
+                                 static_cast<Acts::BinningOption>(opt),
+                                 static_cast<Acts::BinningValue>(val));
+  }
+  return bUtility;
+}
+
+/// Build the surface material of a record
+std::shared_ptr<const Acts::ISurfaceMaterial> buildSurfaceMaterial(
+    const MaterialRecord& record, const Acts::Logger& logger) {
+  if (!record.valid || record.values.size() != 6) {
+    return nullptr;
+  }
+  const auto& t = record.values[0];
+  const auto& x0 = record.values[1];
+  const auto& l0 = record.values[2];
+  const auto& A = record.values[3];
+  const auto& Z = record.values[4];
+  const auto& rho = record.values[5];
+
+  // Get the number of bins
+  const std::size_t nbins0 = record.nBins0;
+  const std::size_t nbins1 = record.nBins1;
+
+  // We need binned material properties
+  if (nbins0 * nbins1 > 1) {
+    // The material matrix
+    Acts::MaterialSlabMatrix materialMatrix(
+        nbins1, Acts::MaterialSlabVector(nbins0, Acts::MaterialSlab()));
+
+    // Fill the matrix first
+    for (std::size_t ib0 = 0; ib0 < nbins0; ++ib0) {
+      for (std::size_t ib1 = 0; ib1 < nbins1; ++ib1) {
+        const std::size_t ib = ib1 * nbins0 + ib0;
+        double dt = t[ib];
+        if (dt > 0.) {
+          // Create material properties
+          const auto material =
+              Acts::Material::fromMassDensity(x0[ib], l0[ib], A[ib], Z[ib],
+                                              rho[ib]);
+          materialMatrix[ib1][ib0] = Acts::MaterialSlab(material, dt);
+        }
+      }
+    }
+
+    // Now reconstruct the bin untilities
+    Acts::BinUtility bUtility = binUtility(record);
+    ACTS_VERBOSE("Created " << bUtility);
+
+    // Construct the binned material with the right bin utility
+    return std::make_shared<const Acts::BinnedSurfaceMaterial>(
+        bUtility, std::move(materialMatrix));
+  }
+
+  // Only homogeneous material present
+  const auto material =
+      Acts::Material::fromMassDensity(x0[0], l0[0], A[0], Z[0], rho[0]);
+  return std::make_shared<const Acts::HomogeneousSurfaceMaterial>(
+      Acts::MaterialSlab(material, t[0]));
+}
+
+/// Fill a material grid with the values of a record
+template <typename grid_t>
+void fillMaterialGrid(const MaterialRecord& record, grid_t& mGrid) {
+  const auto& x0 = record.values[0];
+  const auto& l0 = record.values[1];
+  const auto& A = record.values[2];
+  const auto& Z = record.values[3];
+  const auto& rho = record.values[4];
+  for (std::size_t p = 0; p < record.nBins0; p++) {
+    // Create material properties
+    const auto material =
+        Acts::Material::fromMassDensity(x0[p], l0[p], A[p], Z[p], rho[p]);
+    mGrid.at(p) = material.parameters();
+  }
+}
+
+/// Build the volume material of a record
+std::shared_ptr<const Acts::IVolumeMaterial> buildVolumeMaterial(
+    const MaterialRecord& record, const Acts::Logger& logger) {
+  if (!record.valid || record.values.size() != 5) {
+    return nullptr;
+  }
+
+  // Homogeneous material
+  if (record.binning.empty()) {
+    const auto material = Acts::Material::fromMassDensity(
+        record.values[0][0], record.values[1][0], record.values[2][0],
+        record.values[3][0], record.values[4][0]);
+    return std::make_shared<Acts::HomogeneousVolumeMaterial>(material);
+  }
+
+  // Otherwise the material is either a 2D or a 3D grid
+  Acts::BinUtility bUtility = binUtility(record);
+  ACTS_VERBOSE("Created " << bUtility);
+
+  if (record.binning.size() == 2) {
+    // 2D Grid material
+    std::function<Acts::Vector2(Acts::Vector3)> transfoGlobalToLocal;
+    Acts::Grid2D grid = createGrid2D(bUtility, transfoGlobalToLocal);
+
+    Acts::Grid2D::point_t gMin = grid.minPosition();
+    Acts::Grid2D::point_t gMax = grid.maxPosition();
+    Acts::Grid2D::index_t gNBins = grid.numLocalBins();
+
+    Acts::EAxis axis1(gMin[0], gMax[0], gNBins[0]);
+    Acts::EAxis axis2(gMin[1], gMax[1], gNBins[1]);
+
+    // Build the grid and fill it with data
+    Acts::MaterialGrid2D mGrid(std::make_tuple(axis1, axis2));
+    fillMaterialGrid(record, mGrid);
+
+    Acts::MaterialMapper<Acts::MaterialGrid2D> matMap(transfoGlobalToLocal,
+                                                      mGrid);
+    return std::make_shared<Acts::InterpolatedMaterialMap<
+        Acts::MaterialMapper<Acts::MaterialGrid2D>>>(std::move(matMap),
+                                                     bUtility);
+  } else if (record.binning.size() == 3) {
+    // 3D Grid material
+    std::function<Acts::Vector3(Acts::Vector3)> transfoGlobalToLocal;
+    Acts::Grid3D grid = createGrid3D(bUtility, transfoGlobalToLocal);
+
+    Acts::Grid3D::point_t gMin = grid.minPosition();
+    Acts::Grid3D::point_t gMax = grid.maxPosition();
+    Acts::Grid3D::index_t gNBins = grid.numLocalBins();
+
+    Acts::EAxis axis1(gMin[0], gMax[0], gNBins[0]);
+    Acts::EAxis axis2(gMin[1], gMax[1], gNBins[1]);
+    Acts::EAxis axis3(gMin[2], gMax[2], gNBins[2]);
+
+    // Build the grid and fill it with data
+    Acts::MaterialGrid3D mGrid(std::make_tuple(axis1, axis2, axis3));
+    fillMaterialGrid(record, mGrid);
+
+    Acts::MaterialMapper<Acts::MaterialGrid3D> matMap(transfoGlobalToLocal,
+                                                      mGrid);
+    return std::make_shared<Acts::InterpolatedMaterialMap<
+        Acts::MaterialMapper<Acts::MaterialGrid3D>>>(std::move(matMap),
+                                                     bUtility);
+  }
+  return nullptr;
+}
+
+}  // namespace
+
 ActsExamples::RootMaterialDecorator::RootMaterialDecorator(
     const ActsExamples::RootMaterialDecorator::Config& config,
     Acts::Logging::Level level)
@@ -61,12 +485,31 @@ ActsExamples::RootMaterialDecorator::RootMaterialDecorator(
     throw std::invalid_argument("Missing file name");
   }
 
-  // Setup ROOT I/O
-  m_inputFile = TFile::Open(m_cfg.fileName.c_str());
-  if (m_inputFile == nullptr) {
-    throw std::ios_base::failure("Could not open '" + m_cfg.fileName + "'");
+  // Use an existing cache only if it was written for the same input
+  bool cacheValid = false;
+  if (!m_cfg.cacheFileName.empty() &&
+      std::filesystem::exists(m_cfg.cacheFileName)) {
+    cacheValid = indexCache();
+  }
+  if (!cacheValid) {
+    // Setup ROOT I/O
+    m_inputFile = TFile::Open(m_cfg.fileName.c_str());
+    if (m_inputFile == nullptr) {
+      throw std::ios_base::failure("Could not open '" + m_cfg.fileName + "'");
+    }
+    indexInputFile();
+    if (!m_cfg.cacheFileName.empty()) {
+      writeCache();
+    }
   }
 
+  if (!m_cfg.lazyLoading) {
+    std::lock_guard<std::mutex> lock(m_readMutex);
+    readAllMaterial();
+  }
+}
+
+void ActsExamples::RootMaterialDecorator::indexInputFile() {
   // Get the list of keys from the file
   TList* tlist = m_inputFile->GetListOfKeys();
   auto tIter = tlist->MakeIterator();
@@ -85,9 +528,6 @@ ActsExamples::RootMaterialDecorator::RootMaterialDecorator(
                boost::algorithm::first_finder(m_cfg.voltag));
     // Surface Material
     if (splitNames[0] == m_cfg.folderSurfaceNameBase) {
-      // The surface material to be read in for this
-      std::shared_ptr<const Acts::ISurfaceMaterial> sMaterial = nullptr;
-
       boost::split(splitNames, splitNames[1], boost::is_any_of("_"));
       Acts::GeometryIdentifier::Value volID = std::stoi(splitNames[0]);
       // boundary
@@ -119,107 +559,10 @@ ActsExamples::RootMaterialDecorator::RootMaterialDecorator(
       geoID.setSensitive(senID);
       ACTS_VERBOSE("GeometryIdentifier re-constructed as " << geoID);
 
-      // Construct the names
-      std::string nName = tdName + "/" + m_cfg.ntag;
-      std::string vName = tdName + "/" + m_cfg.vtag;
-      std::string oName = tdName + "/" + m_cfg.otag;
-      std::string minName = tdName + "/" + m_cfg.mintag;
-      std::string maxName = tdName + "/" + m_cfg.maxtag;
-      std::string tName = tdName + "/" + m_cfg.ttag;
-      std::string x0Name = tdName + "/" + m_cfg.x0tag;
-      std::string l0Name = tdName + "/" + m_cfg.l0tag;
-      std::string aName = tdName + "/" + m_cfg.atag;
-      std::string zName = tdName + "/" + m_cfg.ztag;
-      std::string rhoName = tdName + "/" + m_cfg.rhotag;
-
-      // Get the histograms
-      TH1F* n = dynamic_cast<TH1F*>(m_inputFile->Get(nName.c_str()));
-      TH1F* v = dynamic_cast<TH1F*>(m_inputFile->Get(vName.c_str()));
-      TH1F* o = dynamic_cast<TH1F*>(m_inputFile->Get(oName.c_str()));
-      TH1F* min = dynamic_cast<TH1F*>(m_inputFile->Get(minName.c_str()));
-      TH1F* max = dynamic_cast<TH1F*>(m_inputFile->Get(maxName.c_str()));
-      TH2F* t = dynamic_cast<TH2F*>(m_inputFile->Get(tName.c_str()));
-      TH2F* x0 = dynamic_cast<TH2F*>(m_inputFile->Get(x0Name.c_str()));
-      TH2F* l0 = dynamic_cast<TH2F*>(m_inputFile->Get(l0Name.c_str()));
-      TH2F* A = dynamic_cast<TH2F*>(m_inputFile->Get(aName.c_str()));
-      TH2F* Z = dynamic_cast<TH2F*>(m_inputFile->Get(zName.c_str()));
-      TH2F* rho = dynamic_cast<TH2F*>(m_inputFile->Get(rhoName.c_str()));
-
-      std::vector<const TH1*> hists{n, v, o, min, max, t, x0, l0, A, Z, rho};
-
-      // Only go on when you have all histograms
-      if (std::all_of(hists.begin(), hists.end(),
-                      [](const auto* hist) { return hist != nullptr; })) {
-        // Get the number of bins
-        int nbins0 = t->GetNbinsX();
-        int nbins1 = t->GetNbinsY();
-
-        // The material matrix
-        Acts::MaterialSlabMatrix materialMatrix(
-            nbins1, Acts::MaterialSlabVector(nbins0, Acts::MaterialSlab()));
-
-        // We need binned material properties
-        if (nbins0 * nbins1 > 1) {
-          // Fill the matrix first
-          for (int ib0 = 1; ib0 <= nbins0; ++ib0) {
-            for (int ib1 = 1; ib1 <= nbins1; ++ib1) {
-              double dt = t->GetBinContent(ib0, ib1);
-              if (dt > 0.) {
-                double dx0 = x0->GetBinContent(ib0, ib1);
-                double dl0 = l0->GetBinContent(ib0, ib1);
-                double da = A->GetBinContent(ib0, ib1);
-                double dz = Z->GetBinContent(ib0, ib1);
-                double drho = rho->GetBinContent(ib0, ib1);
-                // Create material properties
-                const auto material =
-                    Acts::Material::fromMassDensity(dx0, dl0, da, dz, drho);
-                materialMatrix[ib1 - 1][ib0 - 1] =
-                    Acts::MaterialSlab(material, dt);
-              }
-            }
-          }
-
-          // Now reconstruct the bin untilities
-          Acts::BinUtility bUtility;
-          for (int ib = 1; ib < n->GetNbinsX() + 1; ++ib) {
-            std::size_t nbins = static_cast<std::size_t>(n->GetBinContent(ib));
-            Acts::BinningValue val =
-                static_cast<Acts::BinningValue>(v->GetBinContent(ib));
-            Acts::BinningOption opt =
-                static_cast<Acts::BinningOption>(o->GetBinContent(ib));
-            float rmin = min->GetBinContent(ib);
-            float rmax = max->GetBinContent(ib);
-            bUtility += Acts::BinUtility(nbins, rmin, rmax, opt, val);
-          }
-          ACTS_VERBOSE("Created " << bUtility);
-
-          // Construct the binned material with the right bin utility
-          sMaterial = std::make_shared<const Acts::BinnedSurfaceMaterial>(
-              bUtility, std::move(materialMatrix));
-
-        } else {
-          // Only homogeneous material present
-          double dt = t->GetBinContent(1, 1);
-          double dx0 = x0->GetBinContent(1, 1);
-          double dl0 = l0->GetBinContent(1, 1);
-          double da = A->GetBinContent(1, 1);
-          double dz = Z->GetBinContent(1, 1);
-          double drho = rho->GetBinContent(1, 1);
-          // Create and set the homogeneous surface material
-          const auto material =
-              Acts::Material::fromMassDensity(dx0, dl0, da, dz, drho);
-          sMaterial = std::make_shared<const Acts::HomogeneousSurfaceMaterial>(
-              Acts::MaterialSlab(material, dt));
-        }
-      }
-      ACTS_VERBOSE("Successfully read Material for : " << geoID);
-
-      // Insert into the new collection
-      m_surfaceMaterialMap.insert({geoID, std::move(sMaterial)});
+      // Insert into the index
+      m_surfaceLocations.insert({geoID, {tdName, 0}});
 
     } else if (splitNames[0] == m_cfg.folderVolumeNameBase) {
-      // The volume material to be read in for this
-      std::shared_ptr<const Acts::IVolumeMaterial> vMaterial = nullptr;
       // Volume key
       boost::split(splitNames, splitNames[1], boost::is_any_of("_"));
       Acts::GeometryIdentifier::Value volID = std::stoi(splitNames[0]);
@@ -229,137 +572,8 @@ ActsExamples::RootMaterialDecorator::RootMaterialDecorator(
       geoID.setVolume(volID);
       ACTS_VERBOSE("GeometryIdentifier re-constructed as " << geoID);
 
-      // Construct the names
-      std::string nName = tdName + "/" + m_cfg.ntag;
-      std::string vName = tdName + "/" + m_cfg.vtag;
-      std::string oName = tdName + "/" + m_cfg.otag;
-      std::string minName = tdName + "/" + m_cfg.mintag;
-      std::string maxName = tdName + "/" + m_cfg.maxtag;
-      std::string x0Name = tdName + "/" + m_cfg.x0tag;
-      std::string l0Name = tdName + "/" + m_cfg.l0tag;
-      std::string aName = tdName + "/" + m_cfg.atag;
-      std::string zName = tdName + "/" + m_cfg.ztag;
-      std::string rhoName = tdName + "/" + m_cfg.rhotag;
-
-      // Get the histograms
-      TH1F* n = dynamic_cast<TH1F*>(m_inputFile->Get(nName.c_str()));
-      TH1F* v = dynamic_cast<TH1F*>(m_inputFile->Get(vName.c_str()));
-      TH1F* o = dynamic_cast<TH1F*>(m_inputFile->Get(oName.c_str()));
-      TH1F* min = dynamic_cast<TH1F*>(m_inputFile->Get(minName.c_str()));
-      TH1F* max = dynamic_cast<TH1F*>(m_inputFile->Get(maxName.c_str()));
-      TH1F* x0 = dynamic_cast<TH1F*>(m_inputFile->Get(x0Name.c_str()));
-      TH1F* l0 = dynamic_cast<TH1F*>(m_inputFile->Get(l0Name.c_str()));
-      TH1F* A = dynamic_cast<TH1F*>(m_inputFile->Get(aName.c_str()));
-      TH1F* Z = dynamic_cast<TH1F*>(m_inputFile->Get(zName.c_str()));
-      TH1F* rho = dynamic_cast<TH1F*>(m_inputFile->Get(rhoName.c_str()));
-
-      // Only go on when you have all the material histograms
-      if ((x0 != nullptr) && (l0 != nullptr) && (A != nullptr) &&
-          (Z != nullptr) && (rho != nullptr)) {
-        // Get the number of grid points
-        int points = x0->GetNbinsX();
-        // If the bin information histograms are present the material is
-        // either a 2D or a 3D grid
-        if ((n != nullptr) && (v != nullptr) && (o != nullptr) &&
-            (min != nullptr) && (max != nullptr)) {
-          // Dimension of the grid
-          int dim = n->GetNbinsX();
-          // Now reconstruct the bin untilities
-          Acts::BinUtility bUtility;
-          for (int ib = 1; ib < dim + 1; ++ib) {
-            std::size_t nbins = static_cast<std::size_t>(n->GetBinContent(ib));
-            Acts::BinningValue val =
-                static_cast<Acts::BinningValue>(v->GetBinContent(ib));
-            Acts::BinningOption opt =
-                static_cast<Acts::BinningOption>(o->GetBinContent(ib));
-            float rmin = min->GetBinContent(ib);
-            float rmax = max->GetBinContent(ib);
-            bUtility += Acts::BinUtility(nbins, rmin, rmax, opt, val);
-          }
-          ACTS_VERBOSE("Created " << bUtility);
-
-          if (dim == 2) {
-            // 2D Grid material
-            std::function<Acts::Vector2(Acts::Vector3)> transfoGlobalToLocal;
-            Acts::Grid2D grid = createGrid2D(bUtility, transfoGlobalToLocal);
-
-            Acts::Grid2D::point_t gMin = grid.minPosition();
-            Acts::Grid2D::point_t gMax = grid.maxPosition();
-            Acts::Grid2D::index_t gNBins = grid.numLocalBins();
-
-            Acts::EAxis axis1(gMin[0], gMax[0], gNBins[0]);
-            Acts::EAxis axis2(gMin[1], gMax[1], gNBins[1]);
-
-            // Build the grid and fill it with data
-            Acts::MaterialGrid2D mGrid(std::make_tuple(axis1, axis2));
-
-            for (int p = 1; p <= points; p++) {
-              double dx0 = x0->GetBinContent(p);
-              double dl0 = l0->GetBinContent(p);
-              double da = A->GetBinContent(p);
-              double dz = Z->GetBinContent(p);
-              double drho = rho->GetBinContent(p);
-              // Create material properties
-              const auto material =
-                  Acts::Material::fromMassDensity(dx0, dl0, da, dz, drho);
-              mGrid.at(p - 1) = material.parameters();
-            }
-            Acts::MaterialMapper<Acts::MaterialGrid2D> matMap(
-                transfoGlobalToLocal, mGrid);
-            vMaterial = std::make_shared<Acts::InterpolatedMaterialMap<
-                Acts::MaterialMapper<Acts::MaterialGrid2D>>>(std::move(matMap),
-                                                             bUtility);
-          } else if (dim == 3) {
-            // 3D Grid material
-            std::function<Acts::Vector3(Acts::Vector3)> transfoGlobalToLocal;
-            Acts::Grid3D grid = createGrid3D(bUtility, transfoGlobalToLocal);
-
-            Acts::Grid3D::point_t gMin = grid.minPosition();
-            Acts::Grid3D::point_t gMax = grid.maxPosition();
-            Acts::Grid3D::index_t gNBins = grid.numLocalBins();
-
-            Acts::EAxis axis1(gMin[0], gMax[0], gNBins[0]);
-            Acts::EAxis axis2(gMin[1], gMax[1], gNBins[1]);
-            Acts::EAxis axis3(gMin[2], gMax[2], gNBins[2]);
-
-            // Build the grid and fill it with data
-            Acts::MaterialGrid3D mGrid(std::make_tuple(axis1, axis2, axis3));
-
-            for (int p = 1; p <= points; p++) {
-              double dx0 = x0->GetBinContent(p);
-              double dl0 = l0->GetBinContent(p);
-              double da = A->GetBinContent(p);
-              double dz = Z->GetBinContent(p);
-              double drho = rho->GetBinContent(p);
-              // Create material properties
-              const auto material =
-                  Acts::Material::fromMassDensity(dx0, dl0, da, dz, drho);
-              mGrid.at(p - 1) = material.parameters();
-            }
-            Acts::MaterialMapper<Acts::MaterialGrid3D> matMap(
-                transfoGlobalToLocal, mGrid);
-            vMaterial = std::make_shared<Acts::InterpolatedMaterialMap<
-                Acts::MaterialMapper<Acts::MaterialGrid3D>>>(std::move(matMap),
-                                                             bUtility);
-          }
-        } else {
-          // Homogeneous material
-          double dx0 = x0->GetBinContent(1);
-          double dl0 = l0->GetBinContent(1);
-          double da = A->GetBinContent(1);
-          double dz = Z->GetBinContent(1);
-          double drho = rho->GetBinContent(1);
-          // Create material properties
-          const auto material =
-              Acts::Material::fromMassDensity(dx0, dl0, da, dz, drho);
-          vMaterial =
-              std::make_shared<Acts::HomogeneousVolumeMaterial>(material);
-        }
-      }
-      ACTS_VERBOSE("Successfully read Material for : " << geoID);
-
-      // Insert into the new collection
-      m_volumeMaterialMap.insert({geoID, std::move(vMaterial)});
+      // Insert into the index
+      m_volumeLocations.insert({geoID, {tdName, 0}});
 
       // Incorrect FolderName value
     } else {
@@ -367,9 +581,218 @@ ActsExamples::RootMaterialDecorator::RootMaterialDecorator(
           "Invalid FolderName, does not match any entry in the root file");
     }
   }
+  ACTS_DEBUG("Indexed the material of " << m_surfaceLocations.size()
+                                        << " surfaces and "
+                                        << m_volumeLocations.size()
+                                        << " volumes");
+}
+
+bool ActsExamples::RootMaterialDecorator::indexCache() {
+  int fd = ::open(m_cfg.cacheFileName.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::ios_base::failure("Could not open '" + m_cfg.cacheFileName +
+                                 "'");
+  }
+  struct stat fileStat {};
+  void* data = MAP_FAILED;
+  if (::fstat(fd, &fileStat) == 0 && fileStat.st_size > 0) {
+    data = ::mmap(nullptr, fileStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  }
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    throw std::ios_base::failure("Could not map '" + m_cfg.cacheFileName +
+                                 "'");
+  }
+  m_cacheData = static_cast<const std::byte*>(data);
+  m_cacheSize = fileStat.st_size;
+
+  std::size_t pos = 0;
+  auto magic = readRaw<std::array<char, 8>>(m_cacheData, m_cacheSize, pos);
+  auto version = readRaw<std::uint32_t>(m_cacheData, m_cacheSize, pos);
+  if (magic != s_cacheMagic) {
+    throw std::runtime_error("'" + m_cfg.cacheFileName +
+                             "' is not a material cache");
+  }
+  if (version != s_cacheVersion ||
+      readCacheSource(m_cacheData, m_cacheSize, pos) != cacheSource(m_cfg)) {
+    ACTS_INFO("The material cache '" << m_cfg.cacheFileName
+                                     << "' was not written for '"
+                                     << m_cfg.fileName
+                                     << "' and this configuration, it is "
+                                        "written again");
+    ::munmap(const_cast<std::byte*>(m_cacheData), m_cacheSize);
+    m_cacheData = nullptr;
+    m_cacheSize = 0;
+    return false;
+  }
+  auto nSurfaces = readRaw<std::uint64_t>(m_cacheData, m_cacheSize, pos);
+  auto nVolumes = readRaw<std::uint64_t>(m_cacheData, m_cacheSize, pos);
+  for (std::uint64_t i = 0; i < nSurfaces + nVolumes; ++i) {
+    Acts::GeometryIdentifier geoID(
+        readRaw<std::uint64_t>(m_cacheData, m_cacheSize, pos));
+    auto offset = readRaw<std::uint64_t>(m_cacheData, m_cacheSize, pos);
+    auto& locations = i < nSurfaces ? m_surfaceLocations : m_volumeLocations;
+    locations.insert({geoID, {"", offset}});
+  }
+  ACTS_INFO("Mapped the material cache '"
+            << m_cfg.cacheFileName << "' with " << m_surfaceLocations.size()
+            << " surfaces and " << m_volumeLocations.size() << " volumes");
+  return true;
+}
+
+void ActsExamples::RootMaterialDecorator::writeCache() const {
+  std::string header;
+  appendRaw(header, s_cacheMagic);
+  appendRaw(header, s_cacheVersion);
+  writeCacheSource(header, cacheSource(m_cfg));
+  appendRaw(header, static_cast<std::uint64_t>(m_surfaceLocations.size()));
+  appendRaw(header, static_cast<std::uint64_t>(m_volumeLocations.size()));
+
+  const std::size_t nEntries =
+      m_surfaceLocations.size() + m_volumeLocations.size();
+  const std::size_t headerSize =
+      header.size() + nEntries * 2 * sizeof(std::uint64_t);
+
+  // Serialise the records first to know their offsets. Unless the material
+  // is read lazily, it is built from the records right away instead of
+  // reading the ROOT file a second time.
+  std::string index;
+  std::string records;
+  auto addRecord = [&](const Acts::GeometryIdentifier& geoID,
+                       const MaterialRecord& record) {
+    appendRaw(index, static_cast<std::uint64_t>(geoID.value()));
+    appendRaw(index, static_cast<std::uint64_t>(headerSize + records.size()));
+    writeCacheRecord(records, record);
+  };
+  for (const auto& [geoID, location] : m_surfaceLocations) {
+    auto record =
+        readRootSurfaceRecord(*m_inputFile, m_cfg, location.directory);
+    addRecord(geoID, record);
+    if (!m_cfg.lazyLoading) {
+      m_surfaceMaterialMap.insert(
+          {geoID, buildSurfaceMaterial(record, logger())});
+    }
+  }
+  for (const auto& [geoID, location] : m_volumeLocations) {
+    auto record = readRootVolumeRecord(*m_inputFile, m_cfg, location.directory);
+    addRecord(geoID, record);
+    if (!m_cfg.lazyLoading) {
+      m_volumeMaterialMap.insert(
+          {geoID, buildVolumeMaterial(record, logger())});
+    }
+  }
+
+  // Write to a temporary file first, so that concurrent jobs never see a
+  // partially written cache
+  const std::string tmpName =
+      m_cfg.cacheFileName + "." + std::to_string(::getpid()) + ".tmp";
+  {
+    std::ofstream file(tmpName, std::ios::binary | std::ios::trunc);
+    file << header << index << records;
+    if (!file) {
+      throw std::ios_base::failure("Could not write '" + tmpName + "'");
+    }
+  }
+  if (std::rename(tmpName.c_str(), m_cfg.cacheFileName.c_str()) != 0) {
+    std::remove(tmpName.c_str());
+    throw std::ios_base::failure("Could not write '" + m_cfg.cacheFileName +
+                                 "'");
+  }
+  ACTS_INFO("Wrote the material cache '" << m_cfg.cacheFileName << "'");
+}
+
+std::shared_ptr<const Acts::ISurfaceMaterial>
+ActsExamples::RootMaterialDecorator::readSurfaceMaterial(
+    const RecordLocation& location) const {
+  MaterialRecord record =
+      m_cacheData != nullptr
+          ? readCacheRecord(m_cacheData, m_cacheSize, location.offset)
+          : readRootSurfaceRecord(*m_inputFile, m_cfg, location.directory);
+  return buildSurfaceMaterial(record, logger());
+}
+
+std::shared_ptr<const Acts::IVolumeMaterial>
+ActsExamples::RootMaterialDecorator::readVolumeMaterial(
+    const RecordLocation& location) const {
+  MaterialRecord record =
+      m_cacheData != nullptr
+          ? readCacheRecord(m_cacheData, m_cacheSize, location.offset)
+          : readRootVolumeRecord(*m_inputFile, m_cfg, location.directory);
+  return buildVolumeMaterial(record, logger());
+}
+
+void ActsExamples::RootMaterialDecorator::readAllMaterial() const {
+  for (const auto& [geoID, location] : m_surfaceLocations) {
+    if (m_surfaceMaterialMap.find(geoID) == m_surfaceMaterialMap.end()) {
+      m_surfaceMaterialMap.insert({geoID, readSurfaceMaterial(location)});
+      ACTS_VERBOSE("Successfully read Material for : " << geoID);
+    }
+  }
+  for (const auto& [geoID, location] : m_volumeLocations) {
+    if (m_volumeMaterialMap.find(geoID) == m_volumeMaterialMap.end()) {
+      m_volumeMaterialMap.insert({geoID, readVolumeMaterial(location)});
+      ACTS_VERBOSE("Successfully read Material for : " << geoID);
+    }
+  }
+}
+
+void ActsExamples::RootMaterialDecorator::decorate(
+    Acts::Surface& surface) const {
+  // Null out the material for this surface
+  if (m_clearSurfaceMaterial) {
+    surface.assignSurfaceMaterial(nullptr);
+  }
+  std::lock_guard<std::mutex> lock(m_readMutex);
+  // Try to find the surface in the map, or read it on first access
+  auto sMaterial = m_surfaceMaterialMap.find(surface.geometryId());
+  if (sMaterial == m_surfaceMaterialMap.end()) {
+    auto location = m_surfaceLocations.find(surface.geometryId());
+    if (location == m_surfaceLocations.end()) {
+      return;
+    }
+    sMaterial = m_surfaceMaterialMap
+                    .insert({location->first,
+                             readSurfaceMaterial(location->second)})
+                    .first;
+    ACTS_VERBOSE("Successfully read Material for : " << location->first);
+  }
+  surface.assignSurfaceMaterial(sMaterial->second);
+}
+
+void ActsExamples::RootMaterialDecorator::decorate(
+    Acts::TrackingVolume& volume) const {
+  // Null out the material for this volume
+  if (m_clearSurfaceMaterial) {
+    volume.assignVolumeMaterial(nullptr);
+  }
+  std::lock_guard<std::mutex> lock(m_readMutex);
+  // Try to find the volume in the map, or read it on first access
+  auto vMaterial = m_volumeMaterialMap.find(volume.geometryId());
+  if (vMaterial == m_volumeMaterialMap.end()) {
+    auto location = m_volumeLocations.find(volume.geometryId());
+    if (location == m_volumeLocations.end()) {
+      return;
+    }
+    vMaterial = m_volumeMaterialMap
+                    .insert({location->first,
+                             readVolumeMaterial(location->second)})
+                    .first;
+    ACTS_VERBOSE("Successfully read Material for : " << location->first);
+  }
+  volume.assignVolumeMaterial(vMaterial->second);
+}
+
+const Acts::DetectorMaterialMaps
+ActsExamples::RootMaterialDecorator::materialMaps() const {
+  std::lock_guard<std::mutex> lock(m_readMutex);
+  readAllMaterial();
+  return std::make_pair(m_surfaceMaterialMap, m_volumeMaterialMap);
 }
 
 ActsExamples::RootMaterialDecorator::~RootMaterialDecorator() {
+  if (m_cacheData != nullptr) {
+    ::munmap(const_cast<std::byte*>(m_cacheData), m_cacheSize);
+  }
   if (m_inputFile != nullptr) {
     m_inputFile->Close();
   }
@@ -142,7 +142,8 @@ ProcessCode RootMaterialTrackReader::read(const AlgorithmContext& context) {
   // now read
 
   // The collection to be written
-  std::unordered_map<std::size_t, Acts::RecordedMaterialTrack> mtrackCollection;
+  std::vector<Acts::RecordedMaterialTrack> mtrackCollection;
+  mtrackCollection.reserve(m_batchSize);
 
   // Loop over the entries for this event
   for (std::size_t ib = 0; ib < m_batchSize; ++ib) {
@@ -215,7 +216,7 @@ ProcessCode RootMaterialTrackReader::read(const AlgorithmContext& context) {
       }
       rmTrack.second.materialInteractions.push_back(std::move(mInteraction));
     }
-    mtrackCollection[ib] = (std::move(rmTrack));
+    mtrackCollection.push_back(std::move(rmTrack));
   }
 
   // Write to the collection to the EventStore
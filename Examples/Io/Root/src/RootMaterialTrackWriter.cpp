@@ -130,16 +130,22 @@ ProcessCode RootMaterialTrackWriter::finalize() {
   return ProcessCode::SUCCESS;
 }
 
+ProcessCode RootMaterialTrackWriter::flush() {
+  // ensure exclusive access to tree/file while saving
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputTree->AutoSave("SaveSelf");
+  return ProcessCode::SUCCESS;
+}
+
 ProcessCode RootMaterialTrackWriter::writeT(
     const AlgorithmContext& ctx,
-    const std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>&
-        materialTracks) {
+    const std::vector<Acts::RecordedMaterialTrack>& materialTracks) {
   // Exclusive access to the tree while writing
   std::lock_guard<std::mutex> lock(m_writeMutex);
 
   m_eventId = ctx.eventNumber;
   // Loop over the material tracks and write them out
-  for (auto& [idTrack, mtrack] : materialTracks) {
+  for (auto& mtrack : materialTracks) {
     // Clearing the vector first
     m_step_sx.clear();
     m_step_sy.clear();
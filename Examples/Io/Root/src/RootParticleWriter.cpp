@@ -99,6 +99,13 @@ ActsExamples::ProcessCode ActsExamples::RootParticleWriter::finalize() {
   return ProcessCode::SUCCESS;
 }
 
+ActsExamples::ProcessCode ActsExamples::RootParticleWriter::flush() {
+  // ensure exclusive access to tree/file while saving
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputTree->AutoSave("SaveSelf");
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootParticleWriter::writeT(
     const AlgorithmContext& ctx, const SimParticleContainer& particles) {
   const SimParticleContainer* finalParticles = nullptr;
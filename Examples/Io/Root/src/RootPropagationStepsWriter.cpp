@@ -96,9 +96,16 @@ ActsExamples::ProcessCode ActsExamples::RootPropagationStepsWriter::finalize() {
   return ProcessCode::SUCCESS;
 }
 
+ActsExamples::ProcessCode ActsExamples::RootPropagationStepsWriter::flush() {
+  // ensure exclusive access to tree/file while saving
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputTree->AutoSave("SaveSelf");
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootPropagationStepsWriter::writeT(
     const AlgorithmContext& context,
-    const std::vector<PropagationSteps>& stepCollection) {
+    const PropagationStepContainer& stepCollection) {
   // Exclusive access to the tree while writing
   std::lock_guard<std::mutex> lock(m_writeMutex);
 
@@ -109,8 +116,9 @@ ActsExamples::ProcessCode ActsExamples::RootPropagationStepsWriter::writeT(
   // This is used to calculate the number of trials per step
   std::size_t lastTotalTrials = 0;
 
-  // Loop over the step vector of each test propagation in this
-  for (auto& steps : stepCollection) {
+  // Loop over the steps of each test propagation in this
+  for (std::size_t ip = 0; ip < stepCollection.size(); ++ip) {
+    const auto steps = stepCollection[ip];
     // Clear the vectors for each collection
     m_volumeID.clear();
     m_boundaryID.clear();
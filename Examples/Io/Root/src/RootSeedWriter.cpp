@@ -91,6 +91,13 @@ ActsExamples::ProcessCode ActsExamples::RootSeedWriter::finalize() {
   return ProcessCode::SUCCESS;
 }
 
+ActsExamples::ProcessCode ActsExamples::RootSeedWriter::flush() {
+  // ensure exclusive access to tree/file while saving
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputTree->AutoSave("SaveSelf");
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootSeedWriter::writeT(
     const AlgorithmContext& ctx, const ActsExamples::SimSeedContainer& seeds) {
   // ensure exclusive access to tree/file while writing
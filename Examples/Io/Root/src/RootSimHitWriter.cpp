@@ -85,6 +85,13 @@ ActsExamples::ProcessCode ActsExamples::RootSimHitWriter::finalize() {
   return ProcessCode::SUCCESS;
 }
 
+ActsExamples::ProcessCode ActsExamples::RootSimHitWriter::flush() {
+  // ensure exclusive access to tree/file while saving
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputTree->AutoSave("SaveSelf");
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootSimHitWriter::writeT(
     const AlgorithmContext& ctx, const ActsExamples::SimHitContainer& hits) {
   // ensure exclusive access to tree/file while writing
@@ -74,6 +74,13 @@ ActsExamples::ProcessCode ActsExamples::RootSpacepointWriter::finalize() {
   return ProcessCode::SUCCESS;
 }
 
+ActsExamples::ProcessCode ActsExamples::RootSpacepointWriter::flush() {
+  // ensure exclusive access to tree/file while saving
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputTree->AutoSave("SaveSelf");
+  return ProcessCode::SUCCESS;
+}
+
 ActsExamples::ProcessCode ActsExamples::RootSpacepointWriter::writeT(
     const AlgorithmContext& ctx,
     const ActsExamples::SimSpacePointContainer& spacepoints) {
@@ -294,6 +294,13 @@ ProcessCode RootTrackStatesWriter::finalize() {
   return ProcessCode::SUCCESS;
 }
 
+ProcessCode RootTrackStatesWriter::flush() {
+  // ensure exclusive access to tree/file while saving
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputTree->AutoSave("SaveSelf");
+  return ProcessCode::SUCCESS;
+}
+
 RootTrackStatesWriter::StateType RootTrackStatesWriter::getStateType(
     ConstTrackStateProxy state) {
   if (state.typeFlags().test(Acts::OutlierFlag)) {
@@ -22,6 +22,7 @@
 #include "ActsExamples/EventData/TruthMatching.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 #include "ActsExamples/Validation/TrackClassification.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 #include "ActsFatras/EventData/Particle.hpp"
@@ -36,6 +37,8 @@
 #include <optional>
 #include <ostream>
 #include <stdexcept>
+#include <string>
+#include <utility>
 
 #include <TFile.h>
 #include <TTree.h>
@@ -45,6 +48,18 @@ using Acts::VectorHelpers::perp;
 using Acts::VectorHelpers::phi;
 using Acts::VectorHelpers::theta;
 
+namespace {
+
+/// Names of the bound track parameters in the branch names
+const std::array<std::string, Acts::eBoundSize> kParameterNames = {
+    "eLOC0", "eLOC1", "ePHI", "eTHETA", "eQOP", "eT"};
+
+/// Number of entries in the packed upper triangle of the covariance matrix
+constexpr std::size_t kCovPackedSize =
+    Acts::eBoundSize * (Acts::eBoundSize + 1) / 2;
+
+}  // namespace
+
 namespace ActsExamples {
 
 RootTrackSummaryWriter::RootTrackSummaryWriter(
@@ -82,120 +97,82 @@ RootTrackSummaryWriter::RootTrackSummaryWriter(
 
   // I/O parameters
   m_outputTree->Branch("event_nr", &m_eventNr);
-  m_outputTree->Branch("track_nr", &m_trackNr);
-
-  m_outputTree->Branch("nStates", &m_nStates);
-  m_outputTree->Branch("nMeasurements", &m_nMeasurements);
-  m_outputTree->Branch("nOutliers", &m_nOutliers);
-  m_outputTree->Branch("nHoles", &m_nHoles);
-  m_outputTree->Branch("nSharedHits", &m_nSharedHits);
-  m_outputTree->Branch("chi2Sum", &m_chi2Sum);
-  m_outputTree->Branch("NDF", &m_NDF);
-  m_outputTree->Branch("measurementChi2", &m_measurementChi2);
-  m_outputTree->Branch("outlierChi2", &m_outlierChi2);
-  m_outputTree->Branch("measurementVolume", &m_measurementVolume);
-  m_outputTree->Branch("measurementLayer", &m_measurementLayer);
-  m_outputTree->Branch("outlierVolume", &m_outlierVolume);
-  m_outputTree->Branch("outlierLayer", &m_outlierLayer);
-
-  m_outputTree->Branch("nMajorityHits", &m_nMajorityHits);
-  m_outputTree->Branch("majorityParticleId", &m_majorityParticleId);
-  m_outputTree->Branch("trackClassification", &m_trackClassification);
-  m_outputTree->Branch("t_charge", &m_t_charge);
-  m_outputTree->Branch("t_time", &m_t_time);
-  m_outputTree->Branch("t_vx", &m_t_vx);
-  m_outputTree->Branch("t_vy", &m_t_vy);
-  m_outputTree->Branch("t_vz", &m_t_vz);
-  m_outputTree->Branch("t_px", &m_t_px);
-  m_outputTree->Branch("t_py", &m_t_py);
-  m_outputTree->Branch("t_pz", &m_t_pz);
-  m_outputTree->Branch("t_theta", &m_t_theta);
-  m_outputTree->Branch("t_phi", &m_t_phi);
-  m_outputTree->Branch("t_eta", &m_t_eta);
-  m_outputTree->Branch("t_p", &m_t_p);
-  m_outputTree->Branch("t_pT", &m_t_pT);
-  m_outputTree->Branch("t_d0", &m_t_d0);
-  m_outputTree->Branch("t_z0", &m_t_z0);
-
-  m_outputTree->Branch("hasFittedParams", &m_hasFittedParams);
-  m_outputTree->Branch("eLOC0_fit", &m_eLOC0_fit);
-  m_outputTree->Branch("eLOC1_fit", &m_eLOC1_fit);
-  m_outputTree->Branch("ePHI_fit", &m_ePHI_fit);
-  m_outputTree->Branch("eTHETA_fit", &m_eTHETA_fit);
-  m_outputTree->Branch("eQOP_fit", &m_eQOP_fit);
-  m_outputTree->Branch("eT_fit", &m_eT_fit);
-  m_outputTree->Branch("err_eLOC0_fit", &m_err_eLOC0_fit);
-  m_outputTree->Branch("err_eLOC1_fit", &m_err_eLOC1_fit);
-  m_outputTree->Branch("err_ePHI_fit", &m_err_ePHI_fit);
-  m_outputTree->Branch("err_eTHETA_fit", &m_err_eTHETA_fit);
-  m_outputTree->Branch("err_eQOP_fit", &m_err_eQOP_fit);
-  m_outputTree->Branch("err_eT_fit", &m_err_eT_fit);
-  m_outputTree->Branch("res_eLOC0_fit", &m_res_eLOC0_fit);
-  m_outputTree->Branch("res_eLOC1_fit", &m_res_eLOC1_fit);
-  m_outputTree->Branch("res_ePHI_fit", &m_res_ePHI_fit);
-  m_outputTree->Branch("res_eTHETA_fit", &m_res_eTHETA_fit);
-  m_outputTree->Branch("res_eQOP_fit", &m_res_eQOP_fit);
-  m_outputTree->Branch("res_eT_fit", &m_res_eT_fit);
-  m_outputTree->Branch("pull_eLOC0_fit", &m_pull_eLOC0_fit);
-  m_outputTree->Branch("pull_eLOC1_fit", &m_pull_eLOC1_fit);
-  m_outputTree->Branch("pull_ePHI_fit", &m_pull_ePHI_fit);
-  m_outputTree->Branch("pull_eTHETA_fit", &m_pull_eTHETA_fit);
-  m_outputTree->Branch("pull_eQOP_fit", &m_pull_eQOP_fit);
-  m_outputTree->Branch("pull_eT_fit", &m_pull_eT_fit);
+  m_outputTree->Branch("track_nr", &m_columns.trackNr);
+
+  m_outputTree->Branch("nStates", &m_columns.nStates);
+  m_outputTree->Branch("nMeasurements", &m_columns.nMeasurements);
+  m_outputTree->Branch("nOutliers", &m_columns.nOutliers);
+  m_outputTree->Branch("nHoles", &m_columns.nHoles);
+  m_outputTree->Branch("nSharedHits", &m_columns.nSharedHits);
+  m_outputTree->Branch("chi2Sum", &m_columns.chi2Sum);
+  m_outputTree->Branch("NDF", &m_columns.NDF);
+  m_outputTree->Branch("measurementChi2", &m_columns.measurementChi2);
+  m_outputTree->Branch("outlierChi2", &m_columns.outlierChi2);
+  m_outputTree->Branch("measurementVolume", &m_columns.measurementVolume);
+  m_outputTree->Branch("measurementLayer", &m_columns.measurementLayer);
+  m_outputTree->Branch("outlierVolume", &m_columns.outlierVolume);
+  m_outputTree->Branch("outlierLayer", &m_columns.outlierLayer);
+
+  m_outputTree->Branch("nMajorityHits", &m_columns.nMajorityHits);
+  m_outputTree->Branch("majorityParticleId", &m_columns.majorityParticleId);
+  m_outputTree->Branch("trackClassification", &m_columns.trackClassification);
+  m_outputTree->Branch("t_charge", &m_columns.t_charge);
+  m_outputTree->Branch("t_time", &m_columns.t_time);
+  m_outputTree->Branch("t_vx", &m_columns.t_vx);
+  m_outputTree->Branch("t_vy", &m_columns.t_vy);
+  m_outputTree->Branch("t_vz", &m_columns.t_vz);
+  m_outputTree->Branch("t_px", &m_columns.t_px);
+  m_outputTree->Branch("t_py", &m_columns.t_py);
+  m_outputTree->Branch("t_pz", &m_columns.t_pz);
+  m_outputTree->Branch("t_theta", &m_columns.t_theta);
+  m_outputTree->Branch("t_phi", &m_columns.t_phi);
+  m_outputTree->Branch("t_eta", &m_columns.t_eta);
+  m_outputTree->Branch("t_p", &m_columns.t_p);
+  m_outputTree->Branch("t_pT", &m_columns.t_pT);
+  m_outputTree->Branch("t_d0", &m_columns.t_d0);
+  m_outputTree->Branch("t_z0", &m_columns.t_z0);
+
+  m_outputTree->Branch("hasFittedParams", &m_columns.hasFittedParams);
+  for (std::size_t i = 0; i < Acts::eBoundSize; ++i) {
+    m_outputTree->Branch((kParameterNames[i] + "_fit").c_str(),
+                         &m_columns.fit[i]);
+  }
+  for (std::size_t i = 0; i < Acts::eBoundSize; ++i) {
+    m_outputTree->Branch(("err_" + kParameterNames[i] + "_fit").c_str(),
+                         &m_columns.err[i]);
+  }
+  for (std::size_t i = 0; i < Acts::eBoundSize; ++i) {
+    m_outputTree->Branch(("res_" + kParameterNames[i] + "_fit").c_str(),
+                         &m_columns.res[i]);
+  }
+  for (std::size_t i = 0; i < Acts::eBoundSize; ++i) {
+    m_outputTree->Branch(("pull_" + kParameterNames[i] + "_fit").c_str(),
+                         &m_columns.pull[i]);
+  }
 
   if (m_cfg.writeGsfSpecific) {
-    m_outputTree->Branch("max_material_fwd", &m_gsf_max_material_fwd);
-    m_outputTree->Branch("sum_material_fwd", &m_gsf_sum_material_fwd);
+    m_outputTree->Branch("max_material_fwd", &m_columns.gsf_max_material_fwd);
+    m_outputTree->Branch("sum_material_fwd", &m_columns.gsf_sum_material_fwd);
   }
 
-  if (m_cfg.writeCovMat) {
+  if (m_cfg.writeCovMat && m_cfg.packCovMat) {
+    // the upper triangle of the covariance matrix, kCovPackedSize entries
+    // per track
+    m_outputTree->Branch("cov_packed", &m_columns.covPacked);
+  } else if (m_cfg.writeCovMat) {
     // create one branch for every entry of covariance matrix
     // one block for every row of the matrix, every entry gets own branch
-    m_outputTree->Branch("cov_eLOC0_eLOC0", &m_cov_eLOC0_eLOC0);
-    m_outputTree->Branch("cov_eLOC0_eLOC1", &m_cov_eLOC0_eLOC1);
-    m_outputTree->Branch("cov_eLOC0_ePHI", &m_cov_eLOC0_ePHI);
-    m_outputTree->Branch("cov_eLOC0_eTHETA", &m_cov_eLOC0_eTHETA);
-    m_outputTree->Branch("cov_eLOC0_eQOP", &m_cov_eLOC0_eQOP);
-    m_outputTree->Branch("cov_eLOC0_eT", &m_cov_eLOC0_eT);
-
-    m_outputTree->Branch("cov_eLOC1_eLOC0", &m_cov_eLOC1_eLOC0);
-    m_outputTree->Branch("cov_eLOC1_eLOC1", &m_cov_eLOC1_eLOC1);
-    m_outputTree->Branch("cov_eLOC1_ePHI", &m_cov_eLOC1_ePHI);
-    m_outputTree->Branch("cov_eLOC1_eTHETA", &m_cov_eLOC1_eTHETA);
-    m_outputTree->Branch("cov_eLOC1_eQOP", &m_cov_eLOC1_eQOP);
-    m_outputTree->Branch("cov_eLOC1_eT", &m_cov_eLOC1_eT);
-
-    m_outputTree->Branch("cov_ePHI_eLOC0", &m_cov_ePHI_eLOC0);
-    m_outputTree->Branch("cov_ePHI_eLOC1", &m_cov_ePHI_eLOC1);
-    m_outputTree->Branch("cov_ePHI_ePHI", &m_cov_ePHI_ePHI);
-    m_outputTree->Branch("cov_ePHI_eTHETA", &m_cov_ePHI_eTHETA);
-    m_outputTree->Branch("cov_ePHI_eQOP", &m_cov_ePHI_eQOP);
-    m_outputTree->Branch("cov_ePHI_eT", &m_cov_ePHI_eT);
-
-    m_outputTree->Branch("cov_eTHETA_eLOC0", &m_cov_eTHETA_eLOC0);
-    m_outputTree->Branch("cov_eTHETA_eLOC1", &m_cov_eTHETA_eLOC1);
-    m_outputTree->Branch("cov_eTHETA_ePHI", &m_cov_eTHETA_ePHI);
-    m_outputTree->Branch("cov_eTHETA_eTHETA", &m_cov_eTHETA_eTHETA);
-    m_outputTree->Branch("cov_eTHETA_eQOP", &m_cov_eTHETA_eQOP);
-    m_outputTree->Branch("cov_eTHETA_eT", &m_cov_eTHETA_eT);
-
-    m_outputTree->Branch("cov_eQOP_eLOC0", &m_cov_eQOP_eLOC0);
-    m_outputTree->Branch("cov_eQOP_eLOC1", &m_cov_eQOP_eLOC1);
-    m_outputTree->Branch("cov_eQOP_ePHI", &m_cov_eQOP_ePHI);
-    m_outputTree->Branch("cov_eQOP_eTHETA", &m_cov_eQOP_eTHETA);
-    m_outputTree->Branch("cov_eQOP_eQOP", &m_cov_eQOP_eQOP);
-    m_outputTree->Branch("cov_eQOP_eT", &m_cov_eQOP_eT);
-
-    m_outputTree->Branch("cov_eT_eLOC0", &m_cov_eT_eLOC0);
-    m_outputTree->Branch("cov_eT_eLOC1", &m_cov_eT_eLOC1);
-    m_outputTree->Branch("cov_eT_ePHI", &m_cov_eT_ePHI);
-    m_outputTree->Branch("cov_eT_eTHETA", &m_cov_eT_eTHETA);
-    m_outputTree->Branch("cov_eT_eQOP", &m_cov_eT_eQOP);
-    m_outputTree->Branch("cov_eT_eT", &m_cov_eT_eT);
+    for (std::size_t i = 0; i < Acts::eBoundSize; ++i) {
+      for (std::size_t j = 0; j < Acts::eBoundSize; ++j) {
+        m_outputTree->Branch(
+            ("cov_" + kParameterNames[i] + "_" + kParameterNames[j]).c_str(),
+            &m_columns.cov[i * Acts::eBoundSize + j]);
+      }
+    }
   }
 
   if (m_cfg.writeGx2fSpecific) {
-    m_outputTree->Branch("nUpdatesGx2f", &m_nUpdatesGx2f);
+    m_outputTree->Branch("nUpdatesGx2f", &m_columns.nUpdatesGx2f);
   }
 }
 
@@ -208,7 +185,9 @@ ProcessCode RootTrackSummaryWriter::finalize() {
   m_outputTree->Write();
   m_outputFile->Close();
 
-  if (m_cfg.writeCovMat) {
+  if (m_cfg.writeCovMat && m_cfg.packCovMat) {
+    ACTS_INFO("Wrote packed covariance matrix to tree");
+  } else if (m_cfg.writeCovMat) {
     ACTS_INFO("Wrote full covariance matrix to tree");
   }
   ACTS_INFO("Wrote parameters of tracks to tree '" << m_cfg.treeName << "' in '"
@@ -217,39 +196,104 @@ ProcessCode RootTrackSummaryWriter::finalize() {
   return ProcessCode::SUCCESS;
 }
 
+ProcessCode RootTrackSummaryWriter::flush() {
+  // ensure exclusive access to tree/file while saving
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputTree->AutoSave("SaveSelf");
+  return ProcessCode::SUCCESS;
+}
+
 ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
                                            const ConstTrackContainer& tracks) {
   // Read additional input collections
   const auto& particles = m_inputParticles(ctx);
   const auto& trackParticleMatching = m_inputTrackParticleMatching(ctx);
 
-  // For each particle within a track, how many hits did it contribute
-  std::vector<ParticleHitCount> particleHitCounts;
+  const std::size_t nTracks = tracks.size();
+
+  // The columns of this event are filled outside of the lock and only handed
+  // over to the tree for filling
+  Columns columns;
+  columns.trackNr.resize(nTracks);
+  columns.nStates.resize(nTracks);
+  columns.nMeasurements.resize(nTracks);
+  columns.nOutliers.resize(nTracks);
+  columns.nHoles.resize(nTracks);
+  columns.nSharedHits.resize(nTracks);
+  columns.chi2Sum.resize(nTracks);
+  columns.NDF.resize(nTracks);
+  columns.measurementChi2.resize(nTracks);
+  columns.outlierChi2.resize(nTracks);
+  columns.measurementVolume.resize(nTracks);
+  columns.measurementLayer.resize(nTracks);
+  columns.outlierVolume.resize(nTracks);
+  columns.outlierLayer.resize(nTracks);
+
+  columns.nMajorityHits.resize(nTracks);
+  columns.majorityParticleId.resize(nTracks);
+  columns.trackClassification.resize(nTracks);
+  columns.t_charge.resize(nTracks);
+  columns.t_time.resize(nTracks);
+  columns.t_vx.resize(nTracks);
+  columns.t_vy.resize(nTracks);
+  columns.t_vz.resize(nTracks);
+  columns.t_px.resize(nTracks);
+  columns.t_py.resize(nTracks);
+  columns.t_pz.resize(nTracks);
+  columns.t_theta.resize(nTracks);
+  columns.t_phi.resize(nTracks);
+  columns.t_p.resize(nTracks);
+  columns.t_pT.resize(nTracks);
+  columns.t_eta.resize(nTracks);
+  columns.t_d0.resize(nTracks);
+  columns.t_z0.resize(nTracks);
+
+  columns.hasFittedParams.resize(nTracks);
+  for (std::size_t i = 0; i < Acts::eBoundSize; ++i) {
+    columns.fit[i].resize(nTracks);
+    columns.err[i].resize(nTracks);
+    columns.res[i].resize(nTracks);
+    columns.pull[i].resize(nTracks);
+  }
 
-  // Exclusive access to the tree while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
+  if (m_cfg.writeGsfSpecific) {
+    columns.gsf_max_material_fwd.resize(nTracks);
+    columns.gsf_sum_material_fwd.resize(nTracks);
+  }
 
-  // Get the event number
-  m_eventNr = ctx.eventNumber;
+  if (m_cfg.writeCovMat && m_cfg.packCovMat) {
+    columns.covPacked.resize(nTracks * kCovPackedSize);
+  } else if (m_cfg.writeCovMat) {
+    for (auto& column : columns.cov) {
+      column.resize(nTracks);
+    }
+  }
 
-  for (const auto& track : tracks) {
-    m_trackNr.push_back(track.index());
+  if (m_cfg.writeGx2fSpecific) {
+    columns.nUpdatesGx2f.resize(nTracks);
+  }
+
+  // Every track only writes its own row of the columns
+  auto fillTrack = [&](std::size_t itrack) {
+    const auto track = tracks.getTrack(itrack);
+
+    columns.trackNr[itrack] = track.index();
 
     // Collect the trajectory summary info
-    m_nStates.push_back(track.nTrackStates());
-    m_nMeasurements.push_back(track.nMeasurements());
-    m_nOutliers.push_back(track.nOutliers());
-    m_nHoles.push_back(track.nHoles());
-    m_nSharedHits.push_back(track.nSharedHits());
-    m_chi2Sum.push_back(track.chi2());
-    m_NDF.push_back(track.nDoF());
+    columns.nStates[itrack] = track.nTrackStates();
+    columns.nMeasurements[itrack] = track.nMeasurements();
+    columns.nOutliers[itrack] = track.nOutliers();
+    columns.nHoles[itrack] = track.nHoles();
+    columns.nSharedHits[itrack] = track.nSharedHits();
+    columns.chi2Sum[itrack] = track.chi2();
+    columns.NDF[itrack] = track.nDoF();
     {
-      std::vector<double> measurementChi2;
-      std::vector<std::uint32_t> measurementVolume;
-      std::vector<std::uint32_t> measurementLayer;
-      std::vector<double> outlierChi2;
-      std::vector<std::uint32_t> outlierVolume;
-      std::vector<std::uint32_t> outlierLayer;
+      auto& measurementChi2 = columns.measurementChi2[itrack];
+      auto& measurementVolume = columns.measurementVolume[itrack];
+      auto& measurementLayer = columns.measurementLayer[itrack];
+      auto& outlierChi2 = columns.outlierChi2[itrack];
+      auto& outlierVolume = columns.outlierVolume[itrack];
+      auto& outlierLayer = columns.outlierLayer[itrack];
       for (const auto& state : track.trackStatesReversed()) {
         const auto& geoID = state.referenceSurface().geometryId();
         const auto& volume = geoID.volume();
@@ -265,14 +309,6 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
           measurementLayer.push_back(layer);
         }
       }
-      // IDs are stored as double (as the vector of vector of int is not known
-      // to ROOT)
-      m_measurementChi2.push_back(std::move(measurementChi2));
-      m_measurementVolume.push_back(std::move(measurementVolume));
-      m_measurementLayer.push_back(std::move(measurementLayer));
-      m_outlierChi2.push_back(std::move(outlierChi2));
-      m_outlierVolume.push_back(std::move(outlierVolume));
-      m_outlierLayer.push_back(std::move(outlierLayer));
     }
 
     // Initialize the truth particle info
@@ -368,26 +404,27 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
                                              << " not found!");
     }
 
-    // Push the corresponding truth particle info for the track.
-    // Always push back even if majority particle not found
-    m_majorityParticleId.push_back(majorityParticleId.value());
-    m_trackClassification.push_back(static_cast<int>(trackClassification));
-    m_nMajorityHits.push_back(nMajorityHits);
-    m_t_charge.push_back(t_charge);
-    m_t_time.push_back(t_time);
-    m_t_vx.push_back(t_vx);
-    m_t_vy.push_back(t_vy);
-    m_t_vz.push_back(t_vz);
-    m_t_px.push_back(t_px);
-    m_t_py.push_back(t_py);
-    m_t_pz.push_back(t_pz);
-    m_t_theta.push_back(t_theta);
-    m_t_phi.push_back(t_phi);
-    m_t_eta.push_back(t_eta);
-    m_t_p.push_back(t_p);
-    m_t_pT.push_back(t_pT);
-    m_t_d0.push_back(t_d0);
-    m_t_z0.push_back(t_z0);
+    // Set the corresponding truth particle info for the track.
+    // Always set even if majority particle not found
+    columns.majorityParticleId[itrack] = majorityParticleId.value();
+    columns.trackClassification[itrack] =
+        static_cast<int>(trackClassification);
+    columns.nMajorityHits[itrack] = nMajorityHits;
+    columns.t_charge[itrack] = t_charge;
+    columns.t_time[itrack] = t_time;
+    columns.t_vx[itrack] = t_vx;
+    columns.t_vy[itrack] = t_vy;
+    columns.t_vz[itrack] = t_vz;
+    columns.t_px[itrack] = t_px;
+    columns.t_py[itrack] = t_py;
+    columns.t_pz[itrack] = t_pz;
+    columns.t_theta[itrack] = t_theta;
+    columns.t_phi[itrack] = t_phi;
+    columns.t_eta[itrack] = t_eta;
+    columns.t_p[itrack] = t_p;
+    columns.t_pT[itrack] = t_pT;
+    columns.t_d0[itrack] = t_d0;
+    columns.t_z0[itrack] = t_z0;
 
     // Initialize the fitted track parameters info
     std::array<float, Acts::eBoundSize> param = {NaNfloat, NaNfloat, NaNfloat,
@@ -395,9 +432,6 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
     std::array<float, Acts::eBoundSize> error = {NaNfloat, NaNfloat, NaNfloat,
                                                  NaNfloat, NaNfloat, NaNfloat};
 
-    // get entries of covariance matrix. If no entry, return NaN
-    auto getCov = [&](auto i, auto j) { return track.covariance()(i, j); };
-
     bool hasFittedParams = track.hasReferenceSurface();
     if (hasFittedParams) {
       const auto& parameter = track.parameters();
@@ -429,99 +463,50 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
       }
     }
 
-    // Push the fitted track parameters.
-    // Always push back even if no fitted track parameters
-    m_eLOC0_fit.push_back(param[Acts::eBoundLoc0]);
-    m_eLOC1_fit.push_back(param[Acts::eBoundLoc1]);
-    m_ePHI_fit.push_back(param[Acts::eBoundPhi]);
-    m_eTHETA_fit.push_back(param[Acts::eBoundTheta]);
-    m_eQOP_fit.push_back(param[Acts::eBoundQOverP]);
-    m_eT_fit.push_back(param[Acts::eBoundTime]);
-
-    m_res_eLOC0_fit.push_back(res[Acts::eBoundLoc0]);
-    m_res_eLOC1_fit.push_back(res[Acts::eBoundLoc1]);
-    m_res_ePHI_fit.push_back(res[Acts::eBoundPhi]);
-    m_res_eTHETA_fit.push_back(res[Acts::eBoundTheta]);
-    m_res_eQOP_fit.push_back(res[Acts::eBoundQOverP]);
-    m_res_eT_fit.push_back(res[Acts::eBoundTime]);
-
-    m_err_eLOC0_fit.push_back(error[Acts::eBoundLoc0]);
-    m_err_eLOC1_fit.push_back(error[Acts::eBoundLoc1]);
-    m_err_ePHI_fit.push_back(error[Acts::eBoundPhi]);
-    m_err_eTHETA_fit.push_back(error[Acts::eBoundTheta]);
-    m_err_eQOP_fit.push_back(error[Acts::eBoundQOverP]);
-    m_err_eT_fit.push_back(error[Acts::eBoundTime]);
-
-    m_pull_eLOC0_fit.push_back(pull[Acts::eBoundLoc0]);
-    m_pull_eLOC1_fit.push_back(pull[Acts::eBoundLoc1]);
-    m_pull_ePHI_fit.push_back(pull[Acts::eBoundPhi]);
-    m_pull_eTHETA_fit.push_back(pull[Acts::eBoundTheta]);
-    m_pull_eQOP_fit.push_back(pull[Acts::eBoundQOverP]);
-    m_pull_eT_fit.push_back(pull[Acts::eBoundTime]);
-
-    m_hasFittedParams.push_back(hasFittedParams);
+    // Set the fitted track parameters.
+    // Always set even if no fitted track parameters
+    for (unsigned int i = 0; i < Acts::eBoundSize; ++i) {
+      columns.fit[i][itrack] = param[i];
+      columns.err[i][itrack] = error[i];
+      columns.res[i][itrack] = res[i];
+      columns.pull[i][itrack] = pull[i];
+    }
 
     if (m_cfg.writeGsfSpecific) {
       using namespace Acts::GsfConstants;
       if (tracks.hasColumn(Acts::hashString(kFwdMaxMaterialXOverX0))) {
-        m_gsf_max_material_fwd.push_back(
-            track.template component<double>(kFwdMaxMaterialXOverX0));
+        columns.gsf_max_material_fwd[itrack] =
+            track.template component<double>(kFwdMaxMaterialXOverX0);
       } else {
-        m_gsf_max_material_fwd.push_back(NaNfloat);
+        columns.gsf_max_material_fwd[itrack] = NaNfloat;
       }
 
       if (tracks.hasColumn(Acts::hashString(kFwdSumMaterialXOverX0))) {
-        m_gsf_sum_material_fwd.push_back(
-            track.template component<double>(kFwdSumMaterialXOverX0));
+        columns.gsf_sum_material_fwd[itrack] =
+            track.template component<double>(kFwdSumMaterialXOverX0);
       } else {
-        m_gsf_sum_material_fwd.push_back(NaNfloat);
+        columns.gsf_sum_material_fwd[itrack] = NaNfloat;
       }
     }
 
-    if (m_cfg.writeCovMat) {
+    if (m_cfg.writeCovMat && m_cfg.packCovMat) {
+      // write the upper triangle of the covariance matrix row by row
+      const auto& covariance = track.covariance();
+      auto packed = columns.covPacked.begin() + itrack * kCovPackedSize;
+      for (unsigned int i = 0; i < Acts::eBoundSize; ++i) {
+        for (unsigned int j = i; j < Acts::eBoundSize; ++j) {
+          *packed++ = covariance(i, j);
+        }
+      }
+    } else if (m_cfg.writeCovMat) {
       // write all entries of covariance matrix to output file
       // one branch for every entry of the matrix.
-      m_cov_eLOC0_eLOC0.push_back(getCov(0, 0));
-      m_cov_eLOC0_eLOC1.push_back(getCov(0, 1));
-      m_cov_eLOC0_ePHI.push_back(getCov(0, 2));
-      m_cov_eLOC0_eTHETA.push_back(getCov(0, 3));
-      m_cov_eLOC0_eQOP.push_back(getCov(0, 4));
-      m_cov_eLOC0_eT.push_back(getCov(0, 5));
-
-      m_cov_eLOC1_eLOC0.push_back(getCov(1, 0));
-      m_cov_eLOC1_eLOC1.push_back(getCov(1, 1));
-      m_cov_eLOC1_ePHI.push_back(getCov(1, 2));
-      m_cov_eLOC1_eTHETA.push_back(getCov(1, 3));
-      m_cov_eLOC1_eQOP.push_back(getCov(1, 4));
-      m_cov_eLOC1_eT.push_back(getCov(1, 5));
-
-      m_cov_ePHI_eLOC0.push_back(getCov(2, 0));
-      m_cov_ePHI_eLOC1.push_back(getCov(2, 1));
-      m_cov_ePHI_ePHI.push_back(getCov(2, 2));
-      m_cov_ePHI_eTHETA.push_back(getCov(2, 3));
-      m_cov_ePHI_eQOP.push_back(getCov(2, 4));
-      m_cov_ePHI_eT.push_back(getCov(2, 5));
-
-      m_cov_eTHETA_eLOC0.push_back(getCov(3, 0));
-      m_cov_eTHETA_eLOC1.push_back(getCov(3, 1));
-      m_cov_eTHETA_ePHI.push_back(getCov(3, 2));
-      m_cov_eTHETA_eTHETA.push_back(getCov(3, 3));
-      m_cov_eTHETA_eQOP.push_back(getCov(3, 4));
-      m_cov_eTHETA_eT.push_back(getCov(3, 5));
-
-      m_cov_eQOP_eLOC0.push_back(getCov(4, 0));
-      m_cov_eQOP_eLOC1.push_back(getCov(4, 1));
-      m_cov_eQOP_ePHI.push_back(getCov(4, 2));
-      m_cov_eQOP_eTHETA.push_back(getCov(4, 3));
-      m_cov_eQOP_eQOP.push_back(getCov(4, 4));
-      m_cov_eQOP_eT.push_back(getCov(4, 5));
-
-      m_cov_eT_eLOC0.push_back(getCov(5, 0));
-      m_cov_eT_eLOC1.push_back(getCov(5, 1));
-      m_cov_eT_ePHI.push_back(getCov(5, 2));
-      m_cov_eT_eTHETA.push_back(getCov(5, 3));
-      m_cov_eT_eQOP.push_back(getCov(5, 4));
-      m_cov_eT_eT.push_back(getCov(5, 5));
+      const auto& covariance = track.covariance();
+      for (unsigned int i = 0; i < Acts::eBoundSize; ++i) {
+        for (unsigned int j = 0; j < Acts::eBoundSize; ++j) {
+          columns.cov[i * Acts::eBoundSize + j][itrack] = covariance(i, j);
+        }
+      }
     }
 
     if (m_cfg.writeGx2fSpecific) {
@@ -529,124 +514,38 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
         int nUpdate = static_cast<int>(
             track.template component<std::uint32_t,
                                      Acts::hashString("Gx2fnUpdateColumn")>());
-        m_nUpdatesGx2f.push_back(nUpdate);
+        columns.nUpdatesGx2f[itrack] = nUpdate;
       } else {
-        m_nUpdatesGx2f.push_back(-1);
+        columns.nUpdatesGx2f[itrack] = -1;
       }
     }
+  };
+
+  tbbWrap::parallel_for(tbb::blocked_range<std::size_t>(0, nTracks),
+                        [&](const tbb::blocked_range<std::size_t>& range) {
+                          for (std::size_t itrack = range.begin();
+                               itrack != range.end(); ++itrack) {
+                            fillTrack(itrack);
+                          }
+                        });
+
+  // std::vector<bool> can not be written concurrently
+  for (std::size_t itrack = 0; itrack < nTracks; ++itrack) {
+    columns.hasFittedParams[itrack] =
+        tracks.getTrack(itrack).hasReferenceSurface();
   }
 
-  // fill the variables
-  m_outputTree->Fill();
+  // Exclusive access to the tree while writing
+  std::lock_guard<std::mutex> lock(m_writeMutex);
 
-  m_trackNr.clear();
-  m_nStates.clear();
-  m_nMeasurements.clear();
-  m_nOutliers.clear();
-  m_nHoles.clear();
-  m_nSharedHits.clear();
-  m_chi2Sum.clear();
-  m_NDF.clear();
-  m_measurementChi2.clear();
-  m_outlierChi2.clear();
-  m_measurementVolume.clear();
-  m_measurementLayer.clear();
-  m_outlierVolume.clear();
-  m_outlierLayer.clear();
-
-  m_nMajorityHits.clear();
-  m_majorityParticleId.clear();
-  m_trackClassification.clear();
-  m_t_charge.clear();
-  m_t_time.clear();
-  m_t_vx.clear();
-  m_t_vy.clear();
-  m_t_vz.clear();
-  m_t_px.clear();
-  m_t_py.clear();
-  m_t_pz.clear();
-  m_t_theta.clear();
-  m_t_phi.clear();
-  m_t_p.clear();
-  m_t_pT.clear();
-  m_t_eta.clear();
-  m_t_d0.clear();
-  m_t_z0.clear();
-
-  m_hasFittedParams.clear();
-  m_eLOC0_fit.clear();
-  m_eLOC1_fit.clear();
-  m_ePHI_fit.clear();
-  m_eTHETA_fit.clear();
-  m_eQOP_fit.clear();
-  m_eT_fit.clear();
-  m_err_eLOC0_fit.clear();
-  m_err_eLOC1_fit.clear();
-  m_err_ePHI_fit.clear();
-  m_err_eTHETA_fit.clear();
-  m_err_eQOP_fit.clear();
-  m_err_eT_fit.clear();
-  m_res_eLOC0_fit.clear();
-  m_res_eLOC1_fit.clear();
-  m_res_ePHI_fit.clear();
-  m_res_eTHETA_fit.clear();
-  m_res_eQOP_fit.clear();
-  m_res_eT_fit.clear();
-  m_pull_eLOC0_fit.clear();
-  m_pull_eLOC1_fit.clear();
-  m_pull_ePHI_fit.clear();
-  m_pull_eTHETA_fit.clear();
-  m_pull_eQOP_fit.clear();
-  m_pull_eT_fit.clear();
-
-  m_gsf_max_material_fwd.clear();
-  m_gsf_sum_material_fwd.clear();
-
-  if (m_cfg.writeCovMat) {
-    m_cov_eLOC0_eLOC0.clear();
-    m_cov_eLOC0_eLOC1.clear();
-    m_cov_eLOC0_ePHI.clear();
-    m_cov_eLOC0_eTHETA.clear();
-    m_cov_eLOC0_eQOP.clear();
-    m_cov_eLOC0_eT.clear();
-
-    m_cov_eLOC1_eLOC0.clear();
-    m_cov_eLOC1_eLOC1.clear();
-    m_cov_eLOC1_ePHI.clear();
-    m_cov_eLOC1_eTHETA.clear();
-    m_cov_eLOC1_eQOP.clear();
-    m_cov_eLOC1_eT.clear();
-
-    m_cov_ePHI_eLOC0.clear();
-    m_cov_ePHI_eLOC1.clear();
-    m_cov_ePHI_ePHI.clear();
-    m_cov_ePHI_eTHETA.clear();
-    m_cov_ePHI_eQOP.clear();
-    m_cov_ePHI_eT.clear();
-
-    m_cov_eTHETA_eLOC0.clear();
-    m_cov_eTHETA_eLOC1.clear();
-    m_cov_eTHETA_ePHI.clear();
-    m_cov_eTHETA_eTHETA.clear();
-    m_cov_eTHETA_eQOP.clear();
-    m_cov_eTHETA_eT.clear();
-
-    m_cov_eQOP_eLOC0.clear();
-    m_cov_eQOP_eLOC1.clear();
-    m_cov_eQOP_ePHI.clear();
-    m_cov_eQOP_eTHETA.clear();
-    m_cov_eQOP_eQOP.clear();
-    m_cov_eQOP_eT.clear();
-
-    m_cov_eT_eLOC0.clear();
-    m_cov_eT_eLOC1.clear();
-    m_cov_eT_ePHI.clear();
-    m_cov_eT_eTHETA.clear();
-    m_cov_eT_eQOP.clear();
-    m_cov_eT_eT.clear();
-  }
+  // Get the event number
+  m_eventNr = ctx.eventNumber;
+
+  // The branches point to the member columns which take over the buffers
+  m_columns = std::move(columns);
 
-  m_nUpdatesGx2f.clear();
+  // fill the variables
+  m_outputTree->Fill();
 
   return ProcessCode::SUCCESS;
 }
@@ -81,6 +81,13 @@ ProcessCode RootVertexWriter::finalize() {
   return ProcessCode::SUCCESS;
 }
 
+ProcessCode RootVertexWriter::flush() {
+  // ensure exclusive access to tree/file while saving
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputTree->AutoSave("SaveSelf");
+  return ProcessCode::SUCCESS;
+}
+
 ProcessCode RootVertexWriter::writeT(const AlgorithmContext& ctx,
                                      const SimVertexContainer& vertices) {
   // ensure exclusive access to tree/file while writing
@@ -107,6 +107,9 @@ class SvgPointWriter final : public WriterT<GeometryIdMultiset<T>> {
   SvgPointWriter(const Config& cfg,
                  Acts::Logging::Level level = Acts::Logging::INFO);
 
+  /// Journal resume hook
+  bool writesPerEventOutput() const override { return true; }
+
  protected:
   ActsExamples::ProcessCode writeT(
       const ActsExamples::AlgorithmContext& context,
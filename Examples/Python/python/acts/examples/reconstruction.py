@@ -1544,6 +1544,7 @@ def addExaTrkX(
     modelDir: Union[Path, str],
     outputDirRoot: Optional[Union[Path, str]] = None,
     backend: Optional[ExaTrkXBackend] = ExaTrkXBackend.Torch,
+    pipelined: bool = False,
     logLevel: Optional[acts.logging.Level] = None,
 ) -> None:
     customLogLevel = acts.examples.defaultLogging(s, logLevel)
@@ -1630,6 +1631,7 @@ def addExaTrkX(
         graphConstructor=graphConstructor,
         edgeClassifiers=edgeClassifiers,
         trackBuilder=trackBuilder,
+        pipelined=pipelined,
     )
     s.addAlgorithm(findingAlg)
     s.addWhiteboardAlias("prototracks", findingAlg.config.outputProtoTracks)
@@ -0,0 +1,331 @@
+"""Run a pipeline in several processes over disjoint event ranges.
+
+The outputs of the processes are merged into the files of a single-process
+run: per-event files are moved into place, ROOT files are merged with the
+trees concatenated in event order and the histograms added, and CSV files
+written by several processes are concatenated. The resolution means and widths
+of the performance writers are fitted again from the merged histograms. This
+allows scaling components which are not thread-safe, e.g. Geant4 or Pythia8,
+over the cores of one node.
+"""
+
+import multiprocessing
+import re
+import shutil
+import subprocess
+import warnings
+from pathlib import Path
+from typing import Any, Callable, Dict, List, Optional, Tuple, Union
+
+import acts.examples
+
+_timingHeader = "identifier,time_total_s,time_perevent_s"
+
+
+def _runShard(
+    pipeline: Callable[["acts.examples.Sequencer", Path], Any],
+    outputDir: Path,
+    skip: int,
+    events: int,
+    sequencerArgs: Dict[str, Any],
+):
+    s = acts.examples.Sequencer(
+        skip=skip, events=events, outputDir=str(outputDir), **sequencerArgs
+    )
+    # the return value of the pipeline, e.g. the detector, is kept alive
+    keepAlive = pipeline(s, outputDir)
+    s.run()
+    del keepAlive
+
+
+def _mergeRoot(target: Path, sources: List[Path]):
+    hadd = shutil.which("hadd")
+    if hadd is not None:
+        subprocess.check_call(
+            [hadd, "-f", str(target)] + [str(s) for s in sources],
+            stdout=subprocess.DEVNULL,
+        )
+        return
+
+    try:
+        import ROOT
+    except ImportError:
+        raise RuntimeError(f"Merging {target} requires hadd or PyROOT")
+
+    merger = ROOT.TFileMerger(False)
+    merger.OutputFile(str(target), "RECREATE")
+    for source in sources:
+        merger.AddFile(str(source))
+    if not merger.Merge():
+        raise RuntimeError(f"Failed to merge {target}")
+
+
+# object classes which are merged by concatenation instead of addition
+_treeClasses = ("TTree", "TNtuple", "TNtupleD")
+
+# object classes which hadd merges by adding them up
+_addedClasses = ("TH1", "TH2", "TH3", "TProfile", "TEfficiency")
+
+# 2D histograms from which ResPlotTool::refinement fits means and widths
+_resolutionHistogram = re.compile(r"^((?:.*/)?)(res|pull)_(.+)_vs_(eta|pT)$")
+
+
+def _rootObjects(path: Path) -> Dict[str, str]:
+    """Class names of the objects in a ROOT file, by path within the file."""
+    try:
+        import uproot
+
+        with uproot.open(path) as f:
+            classes = f.classnames(recursive=True, cycle=False)
+        return {
+            k: c
+            for k, c in classes.items()
+            if c not in ("TDirectory", "TDirectoryFile")
+        }
+    except ImportError:
+        pass
+
+    try:
+        import ROOT
+    except ImportError:
+        raise RuntimeError(f"Inspecting {path} requires uproot or PyROOT")
+
+    def collect(directory, prefix):
+        objects = {}
+        for key in directory.GetListOfKeys():
+            name = prefix + key.GetName()
+            if key.GetClassName() in ("TDirectory", "TDirectoryFile"):
+                objects.update(collect(key.ReadObj(), name + "/"))
+            else:
+                objects[name] = key.GetClassName()
+        return objects
+
+    f = ROOT.TFile.Open(str(path))
+    if not f or f.IsZombie():
+        raise RuntimeError(f"Failed to open {path}")
+    objects = collect(f, "")
+    f.Close()
+    return objects
+
+
+def _resolutionFits(objects: Dict[str, str]) -> List[Tuple[str, str, str]]:
+    """The 2D histograms of a file with the mean and width histograms which
+    are fitted from them, see ResPlotTool::refinement."""
+    fits = []
+    for name in sorted(objects):
+        match = _resolutionHistogram.match(name)
+        if match is None or not objects[name].startswith("TH2"):
+            continue
+        directory, kind, par, var = match.groups()
+        mean = f"{directory}{kind}mean_{par}_vs_{var}"
+        width = f"{directory}{kind}width_{par}_vs_{var}"
+        if mean in objects and width in objects:
+            fits.append((name, mean, width))
+    return fits
+
+
+def _refitResolutions(path: Path, fits: List[Tuple[str, str, str]]):
+    """Fit the resolution means and widths again from the merged 2D
+    histograms, like PlotHelpers::anaHisto, instead of adding them up."""
+    import ROOT
+
+    f = ROOT.TFile.Open(str(path), "UPDATE")
+    if not f or f.IsZombie():
+        raise RuntimeError(f"Failed to open {path}")
+    for name, meanName, widthName in fits:
+        source = f.Get(name)
+        mean = f.Get(meanName)
+        width = f.Get(widthName)
+        mean.Reset()
+        width.Reset()
+        for j in range(1, source.GetNbinsX() + 1):
+            projection = source.ProjectionY(
+                f"{source.GetName()}_projy_bin{j}", j, j
+            )
+            projection.SetDirectory(ROOT.nullptr)
+            if projection.GetEntries() > 0:
+                r = projection.Fit("gaus", "QS0")
+                if r.Get() and r.Status() % 1000 == 0:
+                    mean.SetBinContent(j, r.Parameter(1))
+                    mean.SetBinError(j, r.ParError(1))
+                    width.SetBinContent(j, r.Parameter(2))
+                    width.SetBinError(j, r.ParError(2))
+        for hist in (mean, width):
+            hist.GetDirectory().cd()
+            hist.Write("", ROOT.TObject.kOverwrite)
+    f.Close()
+
+
+def _mergeTiming(target: Path, sources: List[Path], events: int):
+    totals: Dict[str, float] = {}
+    for source in sources:
+        for line in source.read_text().splitlines()[1:]:
+            if line == "":
+                continue
+            identifier, total, _ = line.rsplit(",", 2)
+            totals[identifier] = totals.get(identifier, 0.0) + float(total)
+
+    with target.open("w") as fh:
+        fh.write(_timingHeader + "\n")
+        for identifier, total in totals.items():
+            fh.write(f"{identifier},{total},{total / events}\n")
+        fh.write("\n")
+
+
+def _mergeCsv(target: Path, sources: List[Path], events: int):
+    header = sources[0].read_text().split("\n", 1)[0]
+    if header == _timingHeader:
+        _mergeTiming(target, sources, events)
+        return
+
+    with target.open("w") as fh:
+        fh.write(header + "\n")
+        for source in sources:
+            lines = source.read_text().splitlines()
+            if len(lines) == 0 or lines[0] != header:
+                raise RuntimeError(f"Cannot merge {source}: different header")
+            for line in lines[1:]:
+                fh.write(line + "\n")
+
+
+def runSharded(
+    pipeline: Callable[["acts.examples.Sequencer", Path], Any],
+    events: int,
+    processes: int,
+    outputDir: Union[Path, str],
+    skip: int = 0,
+    sequencerArgs: Optional[Dict[str, Any]] = None,
+    keepUnmergeable: bool = False,
+):
+    """Run a pipeline over `events` events in `processes` worker processes.
+
+    Each worker creates a sequencer for a contiguous range of events and calls
+    `pipeline(sequencer, shardOutputDir)`, which adds the readers, algorithms
+    and writers and writes all outputs to `shardOutputDir`. Its return value is
+    kept alive until the sequencer has finished, e.g. the detector. The
+    pipeline is called in a freshly spawned process and therefore has to be a
+    module-level function. The random numbers of the examples framework only
+    depend on the event number, so a sharded run with one thread per worker
+    produces the same output as a single-process single-threaded run.
+
+    After all workers succeeded, the outputs are merged into `outputDir`:
+
+    * files written by a single worker, e.g. per-event CSV files, are moved,
+    * ROOT files are merged with `hadd` or PyROOT, concatenating the trees in
+      event order and adding up histograms, profiles and efficiencies,
+    * CSV files are concatenated, and the sequencer timing files are summed,
+    * other files must be identical in all workers.
+
+    The resolution means and widths which the performance writers fit in their
+    finalize step from all events, see ResPlotTool, are not added up but
+    fitted again from the merged 2D histograms, which requires PyROOT. Other
+    objects which hadd cannot add, e.g. the efficiency and fake rate summaries
+    of the CKF and seeding performance writers, raise an error before anything
+    is merged. Such writers should run in a single-process run, or
+    `keepUnmergeable=True` merges anyway with a warning per file, and hadd
+    writes these objects as found in the first worker.
+
+    The per-worker outputs are kept in `outputDir/shards` if a worker fails or
+    the outputs cannot be merged.
+    """
+    if events <= 0:
+        raise ValueError("Number of events must be positive")
+    if processes <= 0:
+        raise ValueError("Number of processes must be positive")
+
+    outputDir = Path(outputDir)
+    shardsDir = outputDir / "shards"
+    sequencerArgs = {"numThreads": 1, **(sequencerArgs or {})}
+
+    processes = min(processes, events)
+    ranges = []
+    begin = skip
+    for i in range(processes):
+        size = events // processes + (1 if i < events % processes else 0)
+        ranges.append((begin, size))
+        begin += size
+
+    ctx = multiprocessing.get_context("spawn")
+    workers = []
+    shardDirs = []
+    for i, (shardSkip, shardEvents) in enumerate(ranges):
+        shardDir = shardsDir / f"shard{i}"
+        shardDir.mkdir(parents=True, exist_ok=True)
+        shardDirs.append(shardDir)
+        workers.append(
+            ctx.Process(
+                target=_runShard,
+                args=(pipeline, shardDir, shardSkip, shardEvents, sequencerArgs),
+            )
+        )
+    for worker in workers:
+        worker.start()
+    for worker in workers:
+        worker.join()
+
+    failed = [i for i, worker in enumerate(workers) if worker.exitcode != 0]
+    if len(failed) > 0:
+        raise RuntimeError(
+            f"Shards {failed} failed, their outputs are kept in {shardsDir}"
+        )
+
+    # collect the outputs of all shards in shard order, i.e. event order
+    outputs: Dict[Path, List[Path]] = {}
+    for shardDir in shardDirs:
+        for file in sorted(shardDir.rglob("*")):
+            if file.is_file():
+                outputs.setdefault(file.relative_to(shardDir), []).append(file)
+
+    # check all outputs before merging, so no output is half merged
+    refits: Dict[Path, List[Tuple[str, str, str]]] = {}
+    for relative, sources in outputs.items():
+        if len(sources) == 1 or relative.suffix != ".root":
+            continue
+        objects = _rootObjects(sources[0])
+        unmergeable = sorted(
+            k
+            for k, c in objects.items()
+            if c not in _treeClasses and not c.startswith(_addedClasses)
+        )
+        if len(unmergeable) > 0:
+            message = (
+                f"{relative} contains objects ({', '.join(unmergeable)}) which "
+                "cannot be added when merging"
+            )
+            if not keepUnmergeable:
+                raise RuntimeError(
+                    f"{message}. Pass keepUnmergeable=True to keep those of the "
+                    f"first shard; the outputs of the shards are kept in "
+                    f"{shardsDir}"
+                )
+            warnings.warn(message, RuntimeWarning)
+
+        fits = _resolutionFits(objects)
+        if len(fits) == 0:
+            continue
+        try:
+            import ROOT
+        except ImportError:
+            raise RuntimeError(
+                f"Fitting the resolutions of {relative} requires PyROOT; the "
+                f"outputs of the shards are kept in {shardsDir}"
+            )
+        refits[relative] = fits
+
+    for relative, sources in outputs.items():
+        target = outputDir / relative
+        target.parent.mkdir(parents=True, exist_ok=True)
+        if len(sources) == 1:
+            shutil.move(str(sources[0]), str(target))
+        elif target.suffix == ".root":
+            _mergeRoot(target, sources)
+            if relative in refits:
+                _refitResolutions(target, refits[relative])
+        elif target.suffix == ".csv":
+            _mergeCsv(target, sources, events)
+        elif all(s.read_bytes() == sources[0].read_bytes() for s in sources):
+            shutil.copyfile(sources[0], target)
+        else:
+            raise RuntimeError(f"Cannot merge {relative}: outputs differ")
+
+    shutil.rmtree(shardsDir)
@@ -28,14 +28,14 @@ void addAmbiguityResolution(Context& ctx) {
   ACTS_PYTHON_DECLARE_ALGORITHM(
       ActsExamples::GreedyAmbiguityResolutionAlgorithm, mex,
       "GreedyAmbiguityResolutionAlgorithm", inputTracks, outputTracks,
-      maximumSharedHits, maximumIterations, nMeasurementsMin);
+      maximumSharedHits, maximumIterations, nMeasurementsMin, parallel);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(
       ActsExamples::ScoreBasedAmbiguityResolutionAlgorithm, mex,
       "ScoreBasedAmbiguityResolutionAlgorithm", inputTracks, configFile,
       outputTracks, minScore, minScoreSharedTracks, maxShared,
       maxSharedTracksPerMeasurement, pTMin, pTMax, phiMin, phiMax, etaMin,
-      etaMax, useAmbiguityFunction);
+      etaMax, useAmbiguityFunction, parallel);
 }
 
 }  // namespace Acts::Python
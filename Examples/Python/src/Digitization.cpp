@@ -72,6 +72,7 @@ void addDigitization(Context& ctx) {
     ACTS_PYTHON_MEMBER(doMerge);
     ACTS_PYTHON_MEMBER(minEnergyDeposit);
     ACTS_PYTHON_MEMBER(digitizationConfigs);
+    ACTS_PYTHON_MEMBER(parallel);
     ACTS_PYTHON_STRUCT_END();
 
     c.def_readonly("mergeNsigma", &Config::mergeNsigma);
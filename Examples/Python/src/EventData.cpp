@@ -8,9 +8,14 @@
 
 #include "Acts/Definitions/PdgParticle.hpp"
 #include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Plugins/Python/Utilities.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
 
+#include <cstddef>
+#include <iterator>
 #include <type_traits>
+#include <vector>
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -74,6 +79,62 @@ void addEventData(Context& ctx) {
           "chargedGeantino", [](py::object /* self */) {
             return Acts::ParticleHypothesis::chargedGeantino();
           });
+
+  {
+    using ActsExamples::IndexSourceLinkContainer;
+    using ModuleIndex = ActsExamples::IndexSourceLinkAccessor::ModuleIndex;
+    using Value = Acts::GeometryIdentifier::Value;
+
+    // Total number of elements found for the geometry ids. The lookups are
+    // repeated in C++, so they can be timed without the conversion overhead.
+    auto countElements = [](const auto& lookup,
+                            const std::vector<Value>& geometryIds,
+                            std::size_t repetitions) {
+      std::size_t nElements = 0;
+      for (std::size_t i = 0; i < repetitions; ++i) {
+        for (auto geometryId : geometryIds) {
+          auto [begin, end] =
+              lookup.equal_range(Acts::GeometryIdentifier(geometryId));
+          nElements += std::distance(begin, end);
+        }
+      }
+      return nElements;
+    };
+
+    py::class_<IndexSourceLinkContainer>(mex, "IndexSourceLinkContainer")
+        .def(py::init([](const std::vector<Value>& geometryIds) {
+               // source link i is on the surface geometryIds[i]
+               std::vector<ActsExamples::IndexSourceLink> sourceLinks;
+               sourceLinks.reserve(geometryIds.size());
+               for (std::size_t i = 0; i < geometryIds.size(); ++i) {
+                 sourceLinks.emplace_back(
+                     Acts::GeometryIdentifier(geometryIds[i]), i);
+               }
+               return IndexSourceLinkContainer(sourceLinks.begin(),
+                                               sourceLinks.end());
+             }),
+             py::arg("geometryIds"))
+        .def("__len__", &IndexSourceLinkContainer::size)
+        .def(
+            "countElements",
+            [=](const IndexSourceLinkContainer& self,
+                const std::vector<Value>& geometryIds,
+                std::size_t repetitions) {
+              return countElements(self, geometryIds, repetitions);
+            },
+            py::arg("geometryIds"), py::arg("repetitions") = 1);
+
+    py::class_<ModuleIndex>(mex, "IndexSourceLinkModuleIndex")
+        .def(py::init<const IndexSourceLinkContainer&>(),
+             py::arg("container"), py::keep_alive<1, 2>())
+        .def(
+            "countElements",
+            [=](const ModuleIndex& self, const std::vector<Value>& geometryIds,
+                std::size_t repetitions) {
+              return countElements(self, geometryIds, repetitions);
+            },
+            py::arg("geometryIds"), py::arg("repetitions") = 1);
+  }
 }
 
 }  // namespace Acts::Python
@@ -203,7 +203,8 @@ void addExaTrkXTrackFinding(Context &ctx) {
                                 inputSpacePoints, inputClusters,
                                 inputTruthGraph, outputProtoTracks, outputGraph,
                                 graphConstructor, edgeClassifiers, trackBuilder,
-                                nodeFeatures, featureScales, filterShortTracks);
+                                nodeFeatures, featureScales, filterShortTracks,
+                                pipelined, maxEventsInFlight);
 
   {
     auto cls =
@@ -253,7 +254,7 @@ void addExaTrkXTrackFinding(Context &ctx) {
       "TrackFindingFromPrototrackAlgorithm", inputProtoTracks,
       inputMeasurements, inputSourceLinks, inputInitialTrackParameters,
       outputTracks, measurementSelectorCfg, trackingGeometry, magneticField,
-      findTracks, tag);
+      findTracks, computeSharedHits, parallel, sourceLinkModuleIndex, tag);
 }
 
 }  // namespace Acts::Python
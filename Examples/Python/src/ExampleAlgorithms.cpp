@@ -39,7 +39,8 @@ void addExampleAlgorithms(Context& ctx) {
       imputParametrisationNuclearInteraction, randomNumbers, trackingGeometry,
       magneticField, pMin, emScattering, emEnergyLossIonisation,
       emEnergyLossRadiation, emPhotonConversion, generateHitsOnSensitive,
-      generateHitsOnMaterial, generateHitsOnPassive, averageHitsPerParticle);
+      generateHitsOnMaterial, generateHitsOnPassive, averageHitsPerParticle,
+      parallel);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::ParticlesPrinter, mex,
                                 "ParticlesPrinter", inputParticles);
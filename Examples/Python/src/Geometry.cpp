@@ -37,6 +37,7 @@
 #include "Acts/Surfaces/SurfaceArray.hpp"
 #include "Acts/Utilities/RangeXD.hpp"
 #include "ActsExamples/Geometry/VolumeAssociationTest.hpp"
+#include "ActsExamples/Geometry/VolumeLookupGrid.hpp"
 
 #include <array>
 #include <memory>
@@ -571,9 +572,34 @@ void addExperimentalGeometry(Context& ctx) {
     ACTS_PYTHON_STRUCT_END();
   }
 
+  {
+    using ActsExamples::VolumeLookupGrid;
+    auto grid =
+        py::class_<VolumeLookupGrid, std::shared_ptr<VolumeLookupGrid>>(
+            mex, "VolumeLookupGrid")
+            .def(py::init<const VolumeLookupGrid::Config&,
+                          std::shared_ptr<const Acts::Experimental::Detector>,
+                          const Acts::GeometryContext&>(),
+                 py::arg("config"), py::arg("detector"),
+                 py::arg("geoContext") = Acts::GeometryContext())
+            .def_property_readonly("config", &VolumeLookupGrid::config);
+
+    auto c = py::class_<VolumeLookupGrid::Config>(grid, "Config")
+                 .def(py::init<>());
+    ACTS_PYTHON_STRUCT_BEGIN(c, VolumeLookupGrid::Config);
+    ACTS_PYTHON_MEMBER(binsR);
+    ACTS_PYTHON_MEMBER(binsPhi);
+    ACTS_PYTHON_MEMBER(binsZ);
+    ACTS_PYTHON_MEMBER(rMax);
+    ACTS_PYTHON_MEMBER(zMax);
+    ACTS_PYTHON_MEMBER(samplesPerBin);
+    ACTS_PYTHON_STRUCT_END();
+  }
+
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::VolumeAssociationTest, mex,
                                 "VolumeAssociationTest", name, ntests,
-                                randomNumbers, randomRange, detector);
+                                randomNumbers, randomRange, detector,
+                                lookupGrid);
 }
 
 }  // namespace Acts::Python
@@ -30,7 +30,7 @@ void addHepMC3(Context& ctx) {
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::HepMCProcessExtractor, hepmc3,
                                 "HepMCProcessExtractor", inputEvents,
                                 outputSimulationProcesses, extractionProcess,
-                                absPdgMin, absPdgMax, pMin);
+                                absPdgMin, absPdgMax, pMin, parallel);
 
   ACTS_PYTHON_DECLARE_WRITER(ActsExamples::HepMC3AsciiWriter, hepmc3,
                              "HepMC3AsciiWriter", outputDir, outputStem,
@@ -76,7 +76,8 @@ void addMaterial(Context& ctx) {
             mex, "RootMaterialDecorator")
             .def(
                 py::init<RootMaterialDecorator::Config, Acts::Logging::Level>(),
-                py::arg("config"), py::arg("level"));
+                py::arg("config"), py::arg("level"))
+            .def("materialMaps", &RootMaterialDecorator::materialMaps);
 
     using Config = RootMaterialDecorator::Config;
     auto c = py::class_<Config>(rmd, "Config").def(py::init<>());
@@ -99,6 +100,8 @@ void addMaterial(Context& ctx) {
     ACTS_PYTHON_MEMBER(ztag);
     ACTS_PYTHON_MEMBER(rhotag);
     ACTS_PYTHON_MEMBER(fileName);
+    ACTS_PYTHON_MEMBER(lazyLoading);
+    ACTS_PYTHON_MEMBER(cacheFileName);
     ACTS_PYTHON_STRUCT_END();
   }
 
@@ -328,6 +331,7 @@ void addMaterial(Context& ctx) {
     ACTS_PYTHON_MEMBER(randomNumberSvc);
     ACTS_PYTHON_MEMBER(materialValidater);
     ACTS_PYTHON_MEMBER(outputMaterialTracks);
+    ACTS_PYTHON_MEMBER(parallel);
     ACTS_PYTHON_STRUCT_END();
   }
 }
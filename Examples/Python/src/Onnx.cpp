@@ -9,6 +9,7 @@
 #include "Acts/Plugins/Python/Utilities.hpp"
 #include "ActsExamples/TrackFindingML/AmbiguityResolutionMLAlgorithm.hpp"
 #include "ActsExamples/TrackFindingML/AmbiguityResolutionMLDBScanAlgorithm.hpp"
+#include "ActsExamples/TrackFindingML/SeedFilterDBScanClustering.hpp"
 #include "ActsExamples/TrackFindingML/SeedFilterMLAlgorithm.hpp"
 
 #include <pybind11/pybind11.h>
@@ -40,6 +41,15 @@ void addOnnx(Context& ctx) {
                                 "SeedFilterMLAlgorithm", inputTrackParameters,
                                 inputSimSeeds, inputSeedFilterNN,
                                 outputTrackParameters, outputSimSeeds,
-                                epsilonDBScan, minPointsDBScan, minSeedScore);
+                                epsilonDBScan, minPointsDBScan, minSeedScore,
+                                gridDBScan);
+
+  onnx.def("dbscanSeedClustering", &Acts::dbscanSeedClustering,
+           py::arg("input"), py::arg("epsilon") = 0.03,
+           py::arg("minPoints") = 2);
+
+  onnx.def("dbscanSeedClusteringGrid", &Acts::dbscanSeedClusteringGrid,
+           py::arg("input"), py::arg("epsilon") = 0.03,
+           py::arg("minPoints") = 2);
 }
 }  // namespace Acts::Python
@@ -105,9 +105,8 @@ void addOutput(Context& ctx) {
   auto [m, mex] = ctx.get("main", "examples");
 
   ACTS_PYTHON_DECLARE_WRITER(
-      ActsExamples::ObjPropagationStepsWriter<Acts::detail::Step>, mex,
-      "ObjPropagationStepsWriter", collection, outputDir, outputScalor,
-      outputPrecision);
+      ActsExamples::ObjPropagationStepsWriter, mex, "ObjPropagationStepsWriter",
+      collection, outputDir, outputScalor, outputPrecision);
 
   {
     auto c = py::class_<ViewConfig>(m, "ViewConfig").def(py::init<>());
@@ -279,7 +278,8 @@ void addOutput(Context& ctx) {
                  .def(py::init<const Writer::Config&, Acts::Logging::Level>(),
                       py::arg("config"), py::arg("level"))
                  .def("write", py::overload_cast<const Acts::TrackingGeometry&>(
-                                   &Writer::write));
+                                   &Writer::write))
+                 .def("writeMaterial", &Writer::writeMaterial);
 
     auto c = py::class_<Writer::Config>(w, "Config").def(py::init<>());
 
@@ -332,7 +332,8 @@ void addOutput(Context& ctx) {
   ACTS_PYTHON_DECLARE_WRITER(
       ActsExamples::RootTrackSummaryWriter, mex, "RootTrackSummaryWriter",
       inputTracks, inputParticles, inputTrackParticleMatching, filePath,
-      treeName, fileMode, writeCovMat, writeGsfSpecific, writeGx2fSpecific);
+      treeName, fileMode, writeCovMat, packCovMat, writeGsfSpecific,
+      writeGx2fSpecific);
 
   ACTS_PYTHON_DECLARE_WRITER(
       ActsExamples::VertexPerformanceWriter, mex, "VertexPerformanceWriter",
@@ -329,6 +329,8 @@ void addTrackFinding(Context& ctx) {
     ACTS_PYTHON_MEMBER(reverseSearch);
     ACTS_PYTHON_MEMBER(seedDeduplication);
     ACTS_PYTHON_MEMBER(stayOnSeed);
+    ACTS_PYTHON_MEMBER(lightweightTrackCandidates);
+    ACTS_PYTHON_MEMBER(sourceLinkModuleIndex);
     ACTS_PYTHON_MEMBER(pixelVolumes);
     ACTS_PYTHON_MEMBER(stripVolumes);
     ACTS_PYTHON_MEMBER(maxPixelHoles);
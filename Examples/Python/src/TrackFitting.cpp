@@ -48,17 +48,18 @@ void addTrackFitting(Context& ctx) {
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::SurfaceSortingAlgorithm, mex,
                                 "SurfaceSortingAlgorithm", inputProtoTracks,
                                 inputSimHits, inputMeasurementSimHitsMap,
-                                outputProtoTracks);
+                                outputProtoTracks, parallel);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::TrackFittingAlgorithm, mex,
                                 "TrackFittingAlgorithm", inputMeasurements,
                                 inputSourceLinks, inputProtoTracks,
                                 inputInitialTrackParameters, inputClusters,
-                                outputTracks, fit, pickTrack, calibrator);
+                                outputTracks, fit, pickTrack, calibrator,
+                                parallel, blockSize);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::RefittingAlgorithm, mex,
                                 "RefittingAlgorithm", inputTracks, outputTracks,
-                                fit, pickTrack);
+                                fit, pickTrack, parallel, blockSize);
 
   {
     py::class_<TrackFitterFunction, std::shared_ptr<TrackFitterFunction>>(
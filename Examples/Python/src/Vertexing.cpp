@@ -53,7 +53,8 @@ void addVertexing(Context& ctx) {
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::VertexFitterAlgorithm, mex,
                                 "VertexFitterAlgorithm", inputTrackParameters,
                                 inputProtoVertices, outputVertices, bField,
-                                doConstrainedFit, constraintPos, constraintCov);
+                                doConstrainedFit, constraintPos, constraintCov,
+                                parallel);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::SingleSeedVertexFinderAlgorithm,
                                 mex, "SingleSeedVertexFinderAlgorithm",
@@ -26,7 +26,7 @@ from acts.examples import (
 )
 
 
-from helpers import geant4Enabled, hepmc3Enabled
+from helpers import geant4Enabled, hepmc3Enabled, onnxEnabled
 
 
 @pytest.mark.parametrize(
@@ -81,3 +81,27 @@ def test_hepmc_algorithms():
 def test_special_algorithm_interfaces():
     # just assert they exists
     assert DigitizationAlgorithm
+
+
+@pytest.mark.skipif(not onnxEnabled, reason="ONNX plugin not enabled")
+def test_dbscan_seed_clustering_grid():
+    import random
+
+    from acts.examples.onnx import dbscanSeedClustering, dbscanSeedClusteringGrid
+
+    # A noise seed visited before its core neighbour is a border seed
+    points = [[0.0, 0.0, 0.0, 0.0], [0.02, 0.0, 0.0, 0.0], [0.04, 0.0, 0.0, 0.0]]
+    assert dbscanSeedClusteringGrid(points, 0.03, 3) == [[0, 1, 2]]
+    assert dbscanSeedClustering(points, 0.03, 3) == [[0, 1, 2]]
+
+    rng = random.Random(42)
+    for trial in range(50):
+        width = rng.uniform(0.05, 0.3)
+        points = [
+            [rng.uniform(0, width) for _ in range(4)]
+            for _ in range(rng.randint(1, 500))
+        ]
+        epsilon = rng.uniform(0.01, 0.05)
+        minPoints = rng.randint(1, 5)
+        grid = dbscanSeedClusteringGrid(points, epsilon, minPoints)
+        assert grid == dbscanSeedClustering(points, epsilon, minPoints)
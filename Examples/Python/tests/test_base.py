@@ -1,9 +1,18 @@
+import shutil
+import subprocess
+import sys
+import textwrap
+import time
+from pathlib import Path
+
 import pytest
 
 import acts
 
 import acts.examples
 
+from helpers import rootEnabled
+
 
 def test_version():
     assert hasattr(acts, "__version__")
@@ -81,6 +90,312 @@ def test_sequencer_multi_threaded(ptcl_gun, capfd):
     assert "Processed 2 events" in cap.out
 
 
+_journal_script = textwrap.dedent(
+    """
+    import sys
+    import time
+
+    import acts
+    import acts.examples
+
+    nEvents, outputDir, journalFile = int(sys.argv[1]), sys.argv[2], sys.argv[3]
+    writeRoot = len(sys.argv) > 4 and sys.argv[4] == "root"
+
+    class SlowAlg(acts.examples.IAlgorithm):
+        def execute(self, context):
+            time.sleep(0.1)
+            return acts.examples.ProcessCode.SUCCESS
+
+    s = acts.examples.Sequencer(
+        events=nEvents, numThreads=1, journalFile=journalFile, journalInterval=1
+    )
+    evGen = acts.examples.EventGenerator(
+        level=acts.logging.INFO,
+        generators=[
+            acts.examples.EventGenerator.Generator(
+                multiplicity=acts.examples.FixedMultiplicityGenerator(n=2),
+                vertex=acts.examples.GaussianVertexGenerator(
+                    stddev=acts.Vector4(0, 0, 0, 0), mean=acts.Vector4(0, 0, 0, 0)
+                ),
+                particles=acts.examples.ParametricParticleGenerator(
+                    p=(1 * acts.UnitConstants.GeV, 10 * acts.UnitConstants.GeV),
+                    numParticles=2,
+                ),
+            )
+        ],
+        outputParticles="particles_input",
+        outputVertices="vertices_input",
+        randomNumbers=acts.examples.RandomNumbers(seed=42),
+    )
+    s.addReader(evGen)
+    s.addAlgorithm(SlowAlg("SlowAlg", acts.logging.INFO))
+    s.addWriter(
+        acts.examples.CsvParticleWriter(
+            level=acts.logging.INFO,
+            inputParticles="particles_input",
+            outputStem="particles",
+            outputDir=outputDir,
+        )
+    )
+    if writeRoot:
+        s.addWriter(
+            acts.examples.RootParticleWriter(
+                level=acts.logging.INFO,
+                inputParticles="particles_input",
+                filePath=outputDir + "/particles.root",
+            )
+        )
+    s.run()
+    """
+)
+
+
+def test_sequencer_journal_resume(tmp_path):
+    script = tmp_path / "journal.py"
+    script.write_text(_journal_script)
+    nEvents = 20
+
+    def run(outputDir, journalFile=""):
+        outputDir.mkdir(exist_ok=True)
+        return [
+            sys.executable,
+            str(script),
+            str(nEvents),
+            str(outputDir),
+            journalFile,
+        ]
+
+    reference = tmp_path / "reference"
+    subprocess.check_call(run(reference))
+
+    resumed = tmp_path / "resumed"
+    journal = tmp_path / "journal.txt"
+
+    def nJournaled():
+        return len(journal.read_text().splitlines()) if journal.exists() else 0
+
+    # kill the job after a few events have been completed
+    proc = subprocess.Popen(run(resumed, str(journal)))
+    while proc.poll() is None and nJournaled() < 5:
+        time.sleep(0.05)
+    proc.kill()
+    proc.wait()
+    assert proc.returncode != 0, "job finished before it could be killed"
+    assert 0 < nJournaled() < nEvents
+
+    subprocess.check_call(run(resumed, str(journal)))
+
+    assert sorted(int(l) for l in journal.read_text().splitlines()) == list(
+        range(nEvents)
+    )
+    files = sorted(f.name for f in reference.iterdir())
+    assert len(files) == nEvents
+    assert sorted(f.name for f in resumed.iterdir()) == files
+    for name in files:
+        assert (resumed / name).read_bytes() == (reference / name).read_bytes()
+
+
+@pytest.mark.skipif(not rootEnabled, reason="ROOT not set up")
+def test_sequencer_journal_refuse_single_file_writer(tmp_path):
+    script = tmp_path / "journal.py"
+    script.write_text(_journal_script)
+
+    journal = tmp_path / "journal.txt"
+    journal.write_text("0\n1\n")
+
+    # the particle tree of events 0 and 1 would be lost
+    outputDir = tmp_path / "output"
+    outputDir.mkdir()
+    proc = subprocess.run(
+        [sys.executable, str(script), "4", str(outputDir), str(journal), "root"]
+    )
+    assert proc.returncode != 0
+    assert journal.read_text() == "0\n1\n"
+
+
+# merging ROOT outputs of several processes requires hadd
+_writeRoot = rootEnabled and shutil.which("hadd") is not None
+
+
+def _shardingPipeline(s, outputDir):
+    evGen = acts.examples.EventGenerator(
+        level=acts.logging.INFO,
+        generators=[
+            acts.examples.EventGenerator.Generator(
+                multiplicity=acts.examples.FixedMultiplicityGenerator(n=2),
+                vertex=acts.examples.GaussianVertexGenerator(
+                    stddev=acts.Vector4(0, 0, 0, 0), mean=acts.Vector4(0, 0, 0, 0)
+                ),
+                particles=acts.examples.ParametricParticleGenerator(
+                    p=(1 * acts.UnitConstants.GeV, 10 * acts.UnitConstants.GeV),
+                    numParticles=2,
+                ),
+            )
+        ],
+        outputParticles="particles_input",
+        outputVertices="vertices_input",
+        randomNumbers=acts.examples.RandomNumbers(seed=42),
+    )
+    s.addReader(evGen)
+
+    (outputDir / "csv").mkdir(exist_ok=True)
+    s.addWriter(
+        acts.examples.CsvParticleWriter(
+            level=acts.logging.INFO,
+            inputParticles=evGen.config.outputParticles,
+            outputStem="particles",
+            outputDir=str(outputDir / "csv"),
+        )
+    )
+    if _writeRoot:
+        s.addWriter(
+            acts.examples.RootParticleWriter(
+                level=acts.logging.INFO,
+                inputParticles=evGen.config.outputParticles,
+                filePath=str(outputDir / "particles.root"),
+            )
+        )
+
+
+def _shardingTrackFitterPipeline(s, outputDir):
+    from truth_tracking_kalman import runTruthTrackingKalman
+
+    srcdir = Path(__file__).resolve().parent.parent.parent.parent
+    detector, trackingGeometry, decorators = acts.examples.GenericDetector.create()
+    runTruthTrackingKalman(
+        trackingGeometry=trackingGeometry,
+        field=acts.ConstantBField(acts.Vector3(0, 0, 2 * acts.UnitConstants.T)),
+        digiConfigFile=srcdir
+        / "Examples/Algorithms/Digitization/share/default-smearing-config-generic.json",
+        outputDir=outputDir,
+        s=s,
+    )
+    return detector, trackingGeometry, decorators
+
+
+def _shardingSummaryPipeline(s, outputDir):
+    import ROOT
+
+    _shardingPipeline(s, outputDir)
+    # stands in for the summaries of the CKF and seeding performance writers
+    f = ROOT.TFile.Open(str(outputDir / "performance.root"), "RECREATE")
+    v = ROOT.TVectorF(1)
+    v[0] = 0.5
+    f.WriteObject(v, "eff_tracks")
+    f.Close()
+
+
+def _rootHistogramContents(path):
+    import ROOT
+
+    contents = {}
+    f = ROOT.TFile.Open(str(path))
+    for key in f.GetListOfKeys():
+        obj = key.ReadObj()
+        if isinstance(obj, ROOT.TEfficiency):
+            hists = [obj.GetPassedHistogram(), obj.GetTotalHistogram()]
+        elif isinstance(obj, ROOT.TH1):
+            hists = [obj]
+        else:
+            continue
+        contents[key.GetName()] = [
+            v
+            for h in hists
+            for i in range(h.GetNcells())
+            for v in (h.GetBinContent(i), h.GetBinError(i))
+        ]
+    f.Close()
+    return contents
+
+
+def test_sequencer_sharding(tmp_path):
+    from acts.examples.sharding import runSharded
+
+    nEvents = 10
+
+    reference = tmp_path / "reference"
+    reference.mkdir()
+    s = acts.examples.Sequencer(events=nEvents, numThreads=1)
+    _shardingPipeline(s, reference)
+    s.run()
+
+    sharded = tmp_path / "sharded"
+    runSharded(_shardingPipeline, events=nEvents, processes=3, outputDir=sharded)
+
+    assert not (sharded / "shards").exists()
+    assert (sharded / "timing.csv").exists()
+    files = sorted(f.name for f in (reference / "csv").iterdir())
+    assert len(files) == nEvents
+    assert sorted(f.name for f in (sharded / "csv").iterdir()) == files
+    for name in files:
+        assert (sharded / "csv" / name).read_bytes() == (
+            reference / "csv" / name
+        ).read_bytes()
+
+    if _writeRoot:
+        from helpers.hash_root import hash_root_file
+
+        assert hash_root_file(
+            sharded / "particles.root", ordering_invariant=False
+        ) == hash_root_file(reference / "particles.root", ordering_invariant=False)
+
+
+@pytest.mark.skipif(not _writeRoot, reason="merging requires ROOT")
+def test_sequencer_sharding_performance(tmp_path):
+    pytest.importorskip("ROOT")
+    from acts.examples.sharding import runSharded
+    from helpers.hash_root import hash_root_file
+
+    nEvents = 10
+
+    reference = tmp_path / "reference"
+    reference.mkdir()
+    s = acts.examples.Sequencer(events=nEvents, numThreads=1)
+    keepAlive = _shardingTrackFitterPipeline(s, reference)
+    s.run()
+    del keepAlive
+
+    sharded = tmp_path / "sharded"
+    runSharded(
+        _shardingTrackFitterPipeline, events=nEvents, processes=2, outputDir=sharded
+    )
+
+    for fn in ("trackstates_kf.root", "tracksummary_kf.root"):
+        assert hash_root_file(sharded / fn) == hash_root_file(reference / fn)
+
+    # efficiencies and profiles are added up, the resolutions are fitted again
+    expected = _rootHistogramContents(reference / "performance_kf.root")
+    contents = _rootHistogramContents(sharded / "performance_kf.root")
+    assert "resmean_qop_vs_eta" in expected
+    assert "trackeff_vs_eta" in expected
+    assert sorted(contents) == sorted(expected)
+    for name, values in expected.items():
+        assert contents[name] == pytest.approx(values, rel=1e-6, abs=1e-12), name
+
+
+def test_sequencer_sharding_unmergeable(tmp_path):
+    pytest.importorskip("ROOT")
+    from acts.examples.sharding import runSharded
+
+    sharded = tmp_path / "sharded"
+    with pytest.raises(RuntimeError, match="eff_tracks"):
+        runSharded(_shardingSummaryPipeline, events=4, processes=2, outputDir=sharded)
+    # nothing is merged, the outputs of the shards are kept
+    assert not (sharded / "performance.root").exists()
+    assert (sharded / "shards" / "shard0" / "performance.root").exists()
+
+    merged = tmp_path / "merged"
+    with pytest.warns(RuntimeWarning, match="eff_tracks"):
+        runSharded(
+            _shardingSummaryPipeline,
+            events=4,
+            processes=2,
+            outputDir=merged,
+            keepUnmergeable=True,
+        )
+    assert (merged / "performance.root").exists()
+
+
 def test_random_number():
     rnd = acts.examples.RandomNumbers(seed=42)
 
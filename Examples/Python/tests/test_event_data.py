@@ -49,3 +49,20 @@ def test_particle_hypothesis():
     assert str(proton) == "ParticleHypothesis{absPdg=p, mass=0.938272, absCharge=1}"
     assert str(geantino) == "ParticleHypothesis{absPdg=0, mass=0, absCharge=0}"
     assert str(chargedGeantino) == "ParticleHypothesis{absPdg=0, mass=0, absCharge=1}"
+
+
+def test_index_source_link_module_index():
+    import acts.examples
+
+    modules = [acts.GeometryIdentifier().setSensitive(i).value() for i in (1, 2, 3)]
+    container = acts.examples.IndexSourceLinkContainer(
+        [modules[2], modules[0], modules[2], modules[2]]
+    )
+    assert len(container) == 4
+
+    index = acts.examples.IndexSourceLinkModuleIndex(container)
+    lookups = modules + [acts.GeometryIdentifier().setSensitive(4).value()]
+    assert container.countElements(lookups) == 4
+    assert index.countElements(lookups) == 4
+    assert index.countElements([modules[2]], repetitions=3) == 9
+    assert index.countElements([modules[1]]) == 0
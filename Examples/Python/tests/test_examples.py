@@ -1238,10 +1238,15 @@ def test_bfield_writing(tmp_path, seq, assert_root_hash):
 
 @pytest.mark.parametrize("backend", ["onnx", "torch"])
 @pytest.mark.parametrize("hardware", ["cpu", "gpu"])
+@pytest.mark.parametrize("pipelined", [False, True], ids=["serial", "pipelined"])
 @pytest.mark.skipif(not exatrkxEnabled, reason="ExaTrkX environment not set up")
-def test_exatrkx(tmp_path, trk_geo, field, assert_root_hash, backend, hardware):
+def test_exatrkx(
+    tmp_path, trk_geo, field, assert_root_hash, backend, hardware, pipelined
+):
     if backend == "onnx" and hardware == "cpu":
         pytest.skip("Combination of ONNX and CPU not yet supported")
+    if pipelined and hardware != "cpu":
+        pytest.skip("Pipelined mode is only tested on the CPU")
 
     root_file = "performance_track_finding.root"
     assert not (tmp_path / root_file).exists()
@@ -1268,18 +1273,35 @@ def test_exatrkx(tmp_path, trk_geo, field, assert_root_hash, backend, hardware):
     if hardware == "cpu":
         env["CUDA_VISIBLE_DEVICES"] = ""
 
-    try:
-        subprocess.check_call(
-            [sys.executable, str(script), backend],
-            cwd=tmp_path,
-            env=env,
-            stderr=subprocess.STDOUT,
-        )
-    except subprocess.CalledProcessError as e:
-        print(e.output.decode("utf-8"))
-        raise
+    def run(cwd, pipelined):
+        try:
+            subprocess.check_call(
+                [sys.executable, str(script), backend]
+                + (["pipelined"] if pipelined else []),
+                cwd=cwd,
+                env=env,
+                stderr=subprocess.STDOUT,
+            )
+        except subprocess.CalledProcessError as e:
+            print(e.output.decode("utf-8"))
+            raise
+
+    run(tmp_path, pipelined)
 
     rfp = tmp_path / root_file
     assert rfp.exists()
 
-    assert_root_hash(root_file, rfp)
+    if not pipelined:
+        assert_root_hash(root_file, rfp)
+        return
+
+    # The pipelined mode runs multi-threaded and must reproduce the serial
+    # output, which is compared directly instead of a stored hash
+    serial = tmp_path / "serial"
+    serial.mkdir()
+    tarfile.open(tarfile_name).extractall(serial)
+    run(serial, False)
+
+    from helpers.hash_root import hash_root_file
+
+    assert hash_root_file(rfp) == hash_root_file(serial / root_file)
@@ -21,6 +21,69 @@ def test_material_root(conf_const):
         assert fileName in str(e)
 
 
+@pytest.mark.root
+def test_material_root_cache(tmp_path):
+    import os
+    import shutil
+
+    import numpy as np
+    import uproot
+
+    source = tmp_path / "material-maps.root"
+    shutil.copy(
+        Path(__file__).parent.parent.parent.parent
+        / "thirdparty/OpenDataDetector/data/odd-material-maps.root",
+        source,
+    )
+    cache = tmp_path / "material-maps.cache"
+
+    def decorate(**kwargs):
+        return acts.examples.RootMaterialDecorator(
+            level=acts.logging.INFO, fileName=str(source), **kwargs
+        )
+
+    def write(decorator, name):
+        path = tmp_path / name
+        writer = acts.examples.RootMaterialWriter(
+            level=acts.logging.INFO, filePath=str(path)
+        )
+        writer.writeMaterial(decorator.materialMaps())
+        del writer
+        return path
+
+    def histograms(path):
+        with uproot.open(path) as f:
+            return {
+                key: f[key].values()
+                for key, cls in f.classnames(recursive=True, cycle=False).items()
+                if cls.startswith("TH")
+            }
+
+    def assertSameMaterial(path):
+        actual = histograms(path)
+        assert actual.keys() == reference.keys()
+        for key, values in reference.items():
+            np.testing.assert_array_equal(actual[key], values, err_msg=key)
+
+    reference = histograms(write(decorate(), "root.root"))
+    assert len(reference) > 0
+
+    # the first decorator writes the cache, the second one reads it
+    assertSameMaterial(write(decorate(cacheFileName=str(cache)), "write.root"))
+    assert cache.exists()
+    cacheTime = cache.stat().st_mtime_ns
+    assertSameMaterial(write(decorate(cacheFileName=str(cache)), "read.root"))
+    assertSameMaterial(
+        write(decorate(cacheFileName=str(cache), lazyLoading=True), "lazy.root")
+    )
+    assert cache.stat().st_mtime_ns == cacheTime
+
+    # a modified input file makes the cache stale
+    os.utime(source, ns=(cacheTime + 10**9, cacheTime + 10**9))
+    assertSameMaterial(write(decorate(cacheFileName=str(cache)), "stale.root"))
+    assert cache.stat().st_mtime_ns != cacheTime
+
+
 def test_json_material_decorator():
     config = MaterialMapJsonConverter.Config()
     deco = JsonMaterialDecorator(
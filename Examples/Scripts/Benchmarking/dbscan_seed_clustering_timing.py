@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+
+"""Time the KD-tree and the grid DBSCAN of the ML seed filter on uniformly
+distributed seeds in the (phi, eta, z, pT) clustering space."""
+
+import argparse
+import random
+import time
+
+from acts.examples.onnx import dbscanSeedClustering, dbscanSeedClusteringGrid
+
+parser = argparse.ArgumentParser(description=__doc__)
+parser.add_argument(
+    "--sizes",
+    type=int,
+    nargs="+",
+    default=[10**3, 10**4, 10**5, 10**6],
+    help="Numbers of seeds",
+)
+parser.add_argument("--epsilon", type=float, default=0.03)
+parser.add_argument("--min-points", type=int, default=2)
+parser.add_argument(
+    "--kdtree-max-size",
+    type=int,
+    default=None,
+    help="Largest number of seeds to time the KD-tree clustering for, all "
+    "sizes by default",
+)
+args = parser.parse_args()
+
+rng = random.Random(42)
+
+print("seeds, clusters, kdtree [s], grid [s]")
+for size in args.sizes:
+    points = [[rng.random() for _ in range(4)] for _ in range(size)]
+
+    start = time.perf_counter()
+    grid = dbscanSeedClusteringGrid(points, args.epsilon, args.min_points)
+    gridTime = time.perf_counter() - start
+
+    kdtreeTime = float("nan")
+    if args.kdtree_max_size is None or size <= args.kdtree_max_size:
+        start = time.perf_counter()
+        kdtree = dbscanSeedClustering(points, args.epsilon, args.min_points)
+        kdtreeTime = time.perf_counter() - start
+        assert grid == kdtree, "The grid and the KD-tree clusterings differ"
+
+    print(f"{size}, {len(grid)}, {kdtreeTime:.3f}, {gridTime:.3f}")
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+
+"""Time the source link lookups of the CKF by surface: the binary search over
+all source links against the per-module table which is built for every event
+with `sourceLinkModuleIndex`."""
+
+import argparse
+import random
+import time
+
+import acts
+import acts.examples
+
+parser = argparse.ArgumentParser(description=__doc__)
+parser.add_argument(
+    "--modules",
+    type=int,
+    nargs="+",
+    default=[2 * 10**4, 2 * 10**5],
+    help="Numbers of modules with measurements",
+)
+parser.add_argument(
+    "--measurements-per-module",
+    type=float,
+    default=1.5,
+    help="Average number of measurements per module",
+)
+parser.add_argument(
+    "--lookups", type=int, default=10**6, help="Number of lookups to time"
+)
+parser.add_argument(
+    "--repetitions", type=int, default=10, help="Repetitions of the lookups"
+)
+args = parser.parse_args()
+
+rng = random.Random(42)
+
+print("modules, measurements, build [ms], binary search [M/s], module index [M/s]")
+for nModules in args.modules:
+    modules = [
+        acts.GeometryIdentifier()
+        .setVolume(1 + i // 200000)
+        .setLayer(2 + 2 * ((i // 5000) % 40))
+        .setSensitive(1 + i % 5000)
+        .value()
+        for i in range(nModules)
+    ]
+    nMeasurements = int(nModules * args.measurements_per_module)
+    container = acts.examples.IndexSourceLinkContainer(
+        [rng.choice(modules) for _ in range(nMeasurements)]
+    )
+    lookups = [rng.choice(modules) for _ in range(args.lookups)]
+    nTotal = args.lookups * args.repetitions
+
+    start = time.perf_counter()
+    index = acts.examples.IndexSourceLinkModuleIndex(container)
+    buildTime = time.perf_counter() - start
+
+    start = time.perf_counter()
+    nSearch = container.countElements(lookups, args.repetitions)
+    searchTime = time.perf_counter() - start
+
+    start = time.perf_counter()
+    nIndex = index.countElements(lookups, args.repetitions)
+    indexTime = time.perf_counter() - start
+
+    assert nSearch == nIndex, "The module index and the binary search differ"
+
+    print(
+        f"{nModules}, {nMeasurements}, {buildTime * 1e3:.1f}, "
+        f"{nTotal / searchTime * 1e-6:.1f}, {nTotal / indexTime * 1e-6:.1f}"
+    )
@@ -19,6 +19,9 @@ if "__main__" == __name__:
     if "torch" in sys.argv:
         backend = ExaTrkXBackend.Torch
 
+    # overlap the stages of different events
+    pipelined = "pipelined" in sys.argv
+
     srcdir = Path(__file__).resolve().parent.parent.parent.parent
 
     detector, trackingGeometry, decorators = acts.examples.GenericDetector.create()
@@ -54,7 +57,7 @@ if "__main__" == __name__:
         assert (modelDir / "filtering.onnx").exists()
         assert (modelDir / "gnn.onnx").exists()
 
-    s = acts.examples.Sequencer(events=2, numThreads=1)
+    s = acts.examples.Sequencer(events=2, numThreads=-1 if pipelined else 1)
     s.config.logLevel = acts.logging.INFO
 
     rnd = acts.examples.RandomNumbers()
@@ -78,6 +81,7 @@ if "__main__" == __name__:
         modelDir,
         outputDir,
         backend=backend,
+        pipelined=pipelined,
     )
 
     s.run()
@@ -23,7 +23,9 @@ from acts.examples import (
 )
 
 
-def runMaterialValidation(s, ntracks, surfaces, outputFile, seed, loglevel):
+def runMaterialValidation(
+    s, ntracks, surfaces, outputFile, seed, loglevel, parallel=False
+):
     # IO for material tracks reading
     wb = WhiteBoard(acts.logging.INFO)
 
@@ -45,6 +47,7 @@ def runMaterialValidation(s, ntracks, surfaces, outputFile, seed, loglevel):
     materialValidationConfig.outputMaterialTracks = "recorded-material-tracks"
     materialValidationConfig.ntracks = ntracks
     materialValidationConfig.randomNumberSvc = rnd
+    materialValidationConfig.parallel = parallel
     materialValidation = MaterialValidation(materialValidationConfig, loglevel)
     s.addAlgorithm(materialValidation)
 
@@ -78,6 +81,11 @@ if "__main__" == __name__:
         "-m", "--map", type=str, default="", help="Input file for the material map"
     )
     p.add_argument("-o", "--output", type=str, default="", help="Output file name")
+    p.add_argument(
+        "--parallel",
+        action="store_true",
+        help="Record the tracks of an event in parallel",
+    )
 
     p.add_argument(
         "--experimental",
@@ -230,5 +238,11 @@ if "__main__" == __name__:
     s = acts.examples.Sequencer(events=args.events, numThreads=args.threads)
 
     runMaterialValidation(
-        s, args.tracks, materialSurfaces, args.output, 42, acts.logging.INFO
+        s,
+        args.tracks,
+        materialSurfaces,
+        args.output,
+        42,
+        acts.logging.INFO,
+        parallel=args.parallel,
     ).run()
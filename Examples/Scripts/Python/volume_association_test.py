@@ -9,7 +9,7 @@ from acts.examples import geant4 as acts_g4
 from acts import GeometryContext, logging
 
 
-def volumeAssociationTest(sequencer, ntests, tdetector):
+def volumeAssociationTest(sequencer, ntests, tdetector, lookupGrid=None):
     rnd = acts.examples.RandomNumbers(seed=42)
 
     alg = acts.examples.VolumeAssociationTest(
@@ -18,6 +18,7 @@ def volumeAssociationTest(sequencer, ntests, tdetector):
         detector=tdetector,
         randomNumbers=rnd,
         randomRange=[1100, 3100],
+        lookupGrid=lookupGrid,
         level=logging.DEBUG,
     )
     # Add the algorithm to the sequenceer
@@ -53,6 +54,14 @@ def main():
         "-n", "--events", type=int, default=1000, help="Number of events to generate"
     )
     p.add_argument("-t", "--tests", type=int, default=10000, help="Tests per track")
+    p.add_argument(
+        "-j", "--threads", type=int, default=1, help="Number of threads to use"
+    )
+    p.add_argument(
+        "--grid",
+        action="store_true",
+        help="Use the volume lookup grid instead of the detector search",
+    )
 
     args = p.parse_args()
     geoContext = GeometryContext()
@@ -62,8 +71,13 @@ def main():
         args.input, [args.sensitives], [args.passives]
     )
     odd = odd_light.get_detector(geoContext, ssurfaces, psurfaces, logging.INFO)
-    seq = acts.examples.Sequencer(events=args.events, numThreads=1)
-    volumeAssociationTest(seq, args.tests, odd).run()
+    lookupGrid = None
+    if args.grid:
+        lookupGrid = acts.examples.VolumeLookupGrid(
+            acts.examples.VolumeLookupGrid.Config(), odd, geoContext
+        )
+    seq = acts.examples.Sequencer(events=args.events, numThreads=args.threads)
+    volumeAssociationTest(seq, args.tests, odd, lookupGrid).run()
 
 
 if "__main__" == __name__: